@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""chem6 throughput and G-value regression benchmark.
+
+Runs each benchmark macro in its own directory, parses the throughput of the
+run summary and the G values (at the last recorded time) of Species.txt and
+compares them with the baselines:
+
+  - the throughput may not drop by more than --throughput-tolerance
+    (relative, 0.10 = 10 %) from the throughput baseline,
+  - each G value may not move by more than --g-sigma combined standard
+    errors of the current and baseline values.
+
+The G values do not depend on the machine (fixed seeds), their baseline
+(--gvalues, benchmark/gvalues.json) is committed with the sources and only
+rewritten with --update-gvalues. The throughput depends on the machine, its
+baseline (--baseline) is recorded in the build directory with --update.
+
+The exit status is 1 when a benchmark regresses or has no baseline, so that
+the "benchmark" target fails.
+
+e.g.) python3 compare.py --chem6 ./chem6 --baseline throughput.json \\
+          --gvalues gvalues.json bench_electron.in bench_MI_proton.in
+"""
+
+import argparse
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+
+THROUGHPUT = re.compile(r"Throughput:\s+([0-9.eE+-]+)")
+
+
+def parse_species(path):
+    """G value and error per species of the last run in Species.txt."""
+    with open(path, encoding="utf-8", errors="replace") as f:
+        lines = [line.split() for line in f if line.strip()]
+
+    # blocks of three lines per run: LET, species (name, ID), values (G, err)
+    results = {}
+    for i in range(len(lines) - 2):
+        if lines[i][0] != "LET":
+            continue
+        names = lines[i + 1][0::2]
+        values = [float(v) for v in lines[i + 2]]
+        results = {name: (values[2 * j], values[2 * j + 1])
+                   for j, name in enumerate(names)}
+    return results
+
+
+def run(chem6, macro):
+    name = os.path.splitext(os.path.basename(macro))[0]
+    os.makedirs(name, exist_ok=True)
+    species = os.path.join(name, "Species.txt")
+    if os.path.exists(species):
+        os.remove(species)
+
+    with open(os.path.join(name, "run.log"), "w") as log:
+        status = subprocess.call([chem6, os.path.abspath(macro)], cwd=name,
+                                 stdout=log, stderr=subprocess.STDOUT)
+    if status != 0:
+        return name, None
+
+    with open(os.path.join(name, "run.log"), errors="replace") as log:
+        throughputs = [float(v) for v in THROUGHPUT.findall(log.read())]
+    return name, {
+        "throughput": throughputs[-1] if throughputs else 0.,
+        "species": parse_species(species) if os.path.exists(species) else {},
+    }
+
+
+def load(path):
+    if not os.path.exists(path):
+        return {}
+    with open(path, encoding="utf-8") as f:
+        return json.load(f)
+
+
+def save(path, values):
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(values, f, indent=2, sort_keys=True, ensure_ascii=False)
+        f.write("\n")
+
+
+def compare_throughput(name, current, reference, args):
+    change = current / reference - 1. if reference > 0. else 0.
+    print("{:<24} throughput {:12.1f} events/min. (baseline {:.1f}, {:+.1%})"
+          .format(name, current, reference, change))
+    if change < -args.throughput_tolerance:
+        return ["throughput {:+.1%}".format(change)]
+    return []
+
+
+def compare_species(name, current, baseline, args):
+    failures = []
+    for species, (g, err) in sorted(baseline.items()):
+        if species not in current:
+            failures.append("{} missing".format(species))
+            continue
+        g_now, err_now = current[species]
+        sigma = math.hypot(err, err_now)
+        drift = abs(g_now - g) / sigma if sigma > 0. else \
+            (0. if g_now == g else math.inf)
+        print("{:<24} {:>12} G {:10.4f} (baseline {:.4f}, {:.1f} sigma)"
+              .format("", species, g_now, g, drift))
+        if drift > args.g_sigma:
+            failures.append("G({}) {:.1f} sigma".format(species, drift))
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--chem6", required=True)
+    parser.add_argument("--baseline", required=True,
+                        help="throughput baseline (machine dependent)")
+    parser.add_argument("--gvalues", required=True,
+                        help="G-value baseline (committed)")
+    parser.add_argument("--throughput-tolerance", type=float, default=0.10)
+    parser.add_argument("--g-sigma", type=float, default=3.)
+    parser.add_argument("--update", action="store_true",
+                        help="record the throughput baseline")
+    parser.add_argument("--update-gvalues", action="store_true",
+                        help="record the G-value baseline")
+    parser.add_argument("macros", nargs="+")
+    args = parser.parse_args()
+
+    throughputs = load(args.baseline)
+    gvalues = load(args.gvalues)
+
+    failed = False
+    for macro in args.macros:
+        name, current = run(args.chem6, macro)
+        if current is None:
+            print("{:<24} FAILED (chem6 exited with an error, see {}/run.log)"
+                  .format(name, name))
+            failed = True
+            continue
+        failures = []
+        if args.update:
+            print("{:<24} throughput {:12.1f} events/min. (recorded)"
+                  .format(name, current["throughput"]))
+            throughputs[name] = current["throughput"]
+        elif name in throughputs:
+            failures += compare_throughput(name, current["throughput"],
+                                           throughputs[name], args)
+        else:
+            failures.append("no throughput baseline (make benchmark_baseline)")
+
+        if args.update_gvalues:
+            print("{:<24} {} G values (recorded)"
+                  .format(name, len(current["species"])))
+            gvalues[name] = current["species"]
+        elif name in gvalues:
+            failures += compare_species(name, current["species"],
+                                        gvalues[name], args)
+        else:
+            failures.append("no G-value baseline in {}".format(args.gvalues))
+
+        if failures:
+            print("{:<24} REGRESSION: {}".format(name, ", ".join(failures)))
+            failed = True
+
+    if args.update:
+        save(args.baseline, throughputs)
+    if args.update_gvalues:
+        save(args.gvalues, gvalues)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+"""chem6 strong- and weak-scaling benchmark.
+
+Runs the same macro at 1, 2, 4 ... N threads
+  - strong scaling: with the events of the macro,
+  - weak scaling:   with the events of the macro per thread,
+and prints a table of the throughput, the parallel efficiency, the peak
+resident memory of the process divided by the thread count (not a per-thread
+measurement: the shared tables are counted once), the time spent in the
+serial merge of the worker runs (Run::Merge, "merge") and in the absorption of the worker scorers
+(ScoreSpecies::AbsorbResultsFromWorkerScorer, "absorb"), taken from the
+stage table of the run summary. The table is also written to Scaling.csv.
+
+e.g.) python3 scaling.py --chem6 ./chem6 --max-threads 16 bench_electron.in
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+THREADS = re.compile(r"^\s*/run/numberOfThreads\b")
+BEAMON = re.compile(r"^(\s*/run/beamOn\s+)(\d+)(.*)$")
+ELAPSED = re.compile(r"Elasped Time:\s+([0-9.eE+-]+)")
+EVENTS = re.compile(r"Event Number:\s+(\d+)")
+
+HEADER = "{:<8}{:>8}{:>10}{:>14}{:>12}{:>12}{:>24}{:>12}{:>12}"
+ROW = "{:<8}{:>8}{:>10}{:>14.1f}{:>12.3f}{:>12.2f}{:>24.1f}{:>12.4f}{:>12.4f}"
+
+
+def thread_counts(max_threads):
+    counts = []
+    n = 1
+    while n < max_threads:
+        counts.append(n)
+        n *= 2
+    counts.append(max_threads)
+    return counts
+
+
+def write_macro(source, path, nthreads, scale):
+    with open(source, encoding="utf-8") as f:
+        lines = f.readlines()
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("/run/numberOfThreads {}\n".format(nthreads))
+        for line in lines:
+            if THREADS.match(line):
+                continue
+            match = BEAMON.match(line)
+            if match:
+                line = "{}{}{}\n".format(match.group(1),
+                                         int(match.group(2)) * scale,
+                                         match.group(3))
+            f.write(line)
+
+
+def stage_total(log, stage):
+    """total time (s) of a stage in the stage tables, summed over the runs"""
+    total = 0.
+    pattern = re.compile(r"^\s*{}\s+(\d+)\s+([0-9.eE+-]+)\s+".format(stage))
+    in_table = False
+    for line in log.splitlines():
+        # the stage table ends at the next " - " section of the summary
+        if line.startswith(" - "):
+            in_table = "Stages (summed over the threads)" in line
+            continue
+        match = pattern.match(line) if in_table else None
+        if match:
+            total += float(match.group(2))
+    return total
+
+
+def run(chem6, macro, nthreads, scale, mode):
+    name = "{}_{}".format(mode, nthreads)
+    os.makedirs(name, exist_ok=True)
+    path = os.path.abspath(os.path.join(name, os.path.basename(macro)))
+    write_macro(macro, path, nthreads, scale)
+
+    with open(os.path.join(name, "run.log"), "w") as log:
+        process = subprocess.Popen([chem6, path], cwd=name, stdout=log,
+                                   stderr=subprocess.STDOUT)
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+    if status != 0:
+        return None
+
+    with open(os.path.join(name, "run.log"), errors="replace") as f:
+        log = f.read()
+    events = sum(int(v) for v in EVENTS.findall(log))
+    elapsed = sum(float(v) for v in ELAPSED.findall(log))
+    return {
+        "events": events,
+        "elapsed": elapsed,
+        "throughput": events / elapsed * 60. if elapsed > 0. else 0.,
+        # kB on Linux, bytes on macOS
+        "memory": usage.ru_maxrss / (1024. if sys.platform != "darwin"
+                                     else 1024. * 1024.),
+        "merge": stage_total(log, "merge"),
+        "absorb": stage_total(log, "absorb"),
+    }
+
+
+def format_row(mode, nthreads, result, efficiency):
+    return ROW.format(mode, nthreads, result["events"], result["throughput"],
+                      efficiency, result["elapsed"],
+                      result["memory"] / nthreads, result["merge"],
+                      result["absorb"])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--chem6", required=True)
+    parser.add_argument("--max-threads", type=int, default=os.cpu_count())
+    parser.add_argument("--mode", choices=["strong", "weak", "both"],
+                        default="both")
+    parser.add_argument("--output", default="Scaling.csv")
+    parser.add_argument("macro")
+    args = parser.parse_args()
+
+    modes = ["strong", "weak"] if args.mode == "both" else [args.mode]
+    header = HEADER.format(
+        "mode", "threads", "events", "events/min.", "efficiency", "time (s)",
+        "peak RSS / threads (MB)", "merge (s)", "absorb (s)")
+    rows = []
+    failed = False
+
+    for mode in modes:
+        reference = None
+        for nthreads in thread_counts(args.max_threads):
+            scale = nthreads if mode == "weak" else 1
+            result = run(args.chem6, args.macro, nthreads, scale, mode)
+            if result is None:
+                print("{:<8}{:>8} FAILED (see {}_{}/run.log)".format(
+                    mode, nthreads, mode, nthreads))
+                failed = True
+                continue
+            if reference is None:
+                reference = (nthreads, result)
+            # throughput per thread relative to the smallest thread count
+            # (strong), time relative to it (weak)
+            n0, r0 = reference
+            if mode == "strong":
+                efficiency = (result["throughput"] * n0
+                              / (r0["throughput"] * nthreads)
+                              if r0["throughput"] > 0. else 0.)
+            else:
+                efficiency = (r0["elapsed"] / result["elapsed"]
+                              if result["elapsed"] > 0. else 0.)
+            rows.append((mode, nthreads, result, efficiency))
+            print(format_row(mode, nthreads, result, efficiency), flush=True)
+
+    print()
+    print(header)
+    for mode, nthreads, result, efficiency in rows:
+        print(format_row(mode, nthreads, result, efficiency))
+
+    with open(args.output, "w") as f:
+        f.write("mode,threads,events,events_per_min,efficiency,time_s,"
+                "peak_rss_mb,peak_rss_mb_over_threads,merge_s,absorb_s\n")
+        for mode, nthreads, result, efficiency in rows:
+            f.write("{},{},{},{:.3f},{:.4f},{:.4f},{:.2f},{:.2f},{:.6f},{:.6f}\n"
+                    .format(mode, nthreads, result["events"],
+                            result["throughput"], efficiency,
+                            result["elapsed"], result["memory"],
+                            result["memory"] / nthreads, result["merge"],
+                            result["absorb"]))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
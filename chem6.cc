@@ -43,6 +43,11 @@
 #include "ActionInitialization.hh"
 #include "DetectorConstruction.hh"
 #include "PhysicsList.hh"
+#include "metrics_exporter.hh"
+#include "perf_messenger.hh"
+#include "startup_profiler.hh"
+#include "tracer.hh"
+#include "timehistory.hh"
 
 #include "G4DNAChemistryManager.hh"
 #include "G4RunManagerFactory.hh"
@@ -50,6 +55,16 @@
 #include "G4UImanager.hh"
 #include "G4VisExecutive.hh"
 
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#define CHEM6_COMBINATIONS
+#endif
+
 /*
  * WARNING : Geant4 was initially not intended for this kind of application
  * This code is delivered as a prototype
@@ -64,18 +79,16 @@
 std::ofstream out;
 long seed = 0;
 bool mioni = false;
+long nProcessedEvents = 0;   // summed over the runs by the master
+double processingTime = 0.;  // (sec)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
-int main(int argc, char** argv)
-{
-  out.open("Species.txt", std::ios::app);
-
-  G4UIExecutive* ui = 0;
-  if (argc == 1) {
-    ui = new G4UIExecutive(argc, argv);
-  }
+namespace {
 
+void Execute(const G4String& macro, const std::vector<G4String>& commands = {},
+             G4UIExecutive* ui = nullptr)
+{
   G4Random::setTheEngine(new CLHEP::RanecuEngine);
 
   auto* runManager = G4RunManagerFactory::CreateRunManager();
@@ -85,28 +98,151 @@ int main(int argc, char** argv)
   runManager->SetUserInitialization(new DetectorConstruction());
   runManager->SetUserInitialization(new ActionInitialization());
 
+  auto* perfMessenger = new MI::PerfMessenger();
+
   // get the pointer to the User Interface manager
   G4UImanager* UI = G4UImanager::GetUIpointer();
+  for (const auto& command : commands) {
+    UI->ApplyCommand(command);
+  }
+  UI->ApplyCommand("/control/execute " + macro);
+  delete ui;
+  delete perfMessenger;
 
-  if (argc > 1)  // batch mode
+  // Free the store: user actions, physics_list and detector_description are
+  // owned and deleted by the run manager, so they should not be deleted
+  // in the main() program !
+  delete runManager;
+
+  // the worker threads are joined
+  MI::Tracer::Instance()->Write();
+  MI::MetricsExporter::Instance()->Stop();
+}
+
+#ifdef CHEM6_COMBINATIONS
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+// NOTE(SO): convenience launcher. The physics of a Geant4 kernel cannot be
+// rebuilt once initialised, so each "physics:chemistry" combination runs
+// the whole Execute() in a forked process with its outputs in its own
+// directory: nothing initialised (geometry, data files, physics tables) is
+// shared, each combination costs a full startup. The throughput goes back
+// through a pipe.
+
+void RunCombinations(const G4String& macro, int ncombinations, char** combinations)
+{
+  const auto macroPath = std::filesystem::absolute(macro.c_str()).string();
+  std::vector<std::string> lines;
+
+  for (int i = 0; i < ncombinations; i++) {
+    std::string combination = combinations[i];
+    auto colon = combination.find(':');
+    if (colon == std::string::npos) {
+      G4cerr << "Invalid combination (physics:chemistry): " << combination << G4endl;
+      continue;
+    }
+    G4String physics = combination.substr(0, colon);
+    G4String chemistry = combination.substr(colon + 1);
+    G4String dir = physics + "_" + chemistry;
+
+    int fd[2];
+    if (pipe(fd) != 0) {
+      G4cerr << "pipe() failed for " << combination << G4endl;
+      continue;
+    }
+    G4cout.flush();
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      close(fd[0]);
+      // the startup of this combination is timed from the fork, not from the
+      // start of the parent
+      TimeHistory::GetTimeHistory()->TakeSplit("Start");
+      MI::StartupProfiler::Instance()->Reset();
+      MI::MetricsExporter::Instance()->SetSweepPoint(combination, i, ncombinations);
+      std::filesystem::create_directories(dir.c_str());
+      std::filesystem::current_path(dir.c_str());
+      out.close();
+      out.open("Species.txt", std::ios::app);
+
+      Execute(macroPath, {"/physlist/dna/physics " + physics,
+                          "/physlist/dna/chemistry " + chemistry});
+      out.close();
+
+      char line[512];
+      auto n = std::snprintf(line, sizeof(line), "%-24s %-26s %10ld %12.2f %14.2f",
+                             physics.c_str(), chemistry.c_str(), nProcessedEvents,
+                             processingTime,
+                             processingTime > 0. ? nProcessedEvents / processingTime * 60.
+                                                 : 0.);
+      if (write(fd[1], line, n) < 0) { _exit(1); }
+      close(fd[1]);
+      _exit(0);
+    }
+
+    close(fd[1]);
+    char buffer[512];
+    std::string line;
+    ssize_t n;
+    while ((n = read(fd[0], buffer, sizeof(buffer))) > 0) {
+      line.append(buffer, n);
+    }
+    close(fd[0]);
+    int status = 0;
+    if (pid > 0) { waitpid(pid, &status, 0); }
+    if (pid < 0 || line.empty() || status != 0) {
+      line = physics;
+      line.resize(24, ' ');
+      line += " " + chemistry + " failed";
+    }
+    lines.push_back(line);
+  }
+
+  G4cout << "\n=============================================" << G4endl;
+  G4cout << " Combination Summary" << G4endl;
+  char header[512];
+  std::snprintf(header, sizeof(header), "%-24s %-26s %10s %12s %14s", "physics",
+                "chemistry", "events", "time (sec)", "events/min.");
+  G4cout << header << G4endl;
+  for (const auto& line : lines) {
+    G4cout << line << G4endl;
+  }
+  G4cout << "=============================================" << G4endl;
+}
+#endif
+
+}  // namespace
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+int main(int argc, char** argv)
+{
+  // NOTE(SO): reference time for the startup measurements
+  TimeHistory::GetTimeHistory()->TakeSplit("Start");
+  MI::StartupProfiler::Instance();
+
+  out.open("Species.txt", std::ios::app);
+
+  if (argc > 2)  // combination mode: chem6 macro physics:chemistry ...
+  {
+#ifdef CHEM6_COMBINATIONS
+    RunCombinations(argv[1], argc - 2, argv + 2);
+#else
+    G4cerr << "Combination mode is not supported on this platform." << G4endl;
+#endif
+  }
+
+  else if (argc > 1)  // batch mode
   {
-    G4String command = "/control/execute ";
-    G4String fileName = argv[1];
-    UI->ApplyCommand(command + fileName);
+    Execute(argv[1]);
   }
 
   else  // define visualization and UI terminal for interactive mode
   {
-    UI->ApplyCommand("/control/execute beam.in");
-    delete ui;
+    Execute("beam.in", {}, new G4UIExecutive(argc, argv));
   }
 
   // Job termination
-  // Free the store: user actions, physics_list and detector_description are
-  // owned and deleted by the run manager, so they should not be deleted
-  // in the main() program !
   out.close();
-  delete runManager;
   return 0;
 }
 
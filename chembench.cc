@@ -0,0 +1,541 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+//
+// chem6_chembench: benchmark of the chemical stage only
+//
+// The species at the beginning of the chemical stage are injected in each
+// event (no physics is simulated), from
+//   - a uniform set:  n species of the approximate yields at 1 ps in a cube,
+//   - a track core:   species of the approximate yields at 1 ps along a
+//                     track of a given LET,
+//   - recorded sets:  species sets written by chem6
+//                     (/scorer/species/speciesSet),
+// and the chemical stage is run with the reaction list and the time-step
+// model of the macro. The throughput, reactions per second, chemistry time
+// per event and peak memory are reported at the end of each run.
+//
+// usage: chem6_chembench macro [time-step model ...]
+//   e.g. chem6_chembench chembench.in IRT IRT_syn SBS
+//   runs the macro once per model (forked processes) and compares them.
+//
+#include "PhysicsList.hh"
+#include "StackingAction.hh"
+#include "TimeStepAction.hh"
+#include "memory_usage.hh"
+#include "species_set.hh"
+#include "timehistory.hh"
+
+#include "G4Box.hh"
+#include "G4DNAChemistryManager.hh"
+#include "G4Event.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Molecule.hh"
+#include "G4MoleculeTable.hh"
+#include "G4NistManager.hh"
+#include "G4PVPlacement.hh"
+#include "G4Run.hh"
+#include "G4RunManager.hh"
+#include "G4RunManagerFactory.hh"
+#include "G4Scheduler.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIdirectory.hh"
+#include "G4UImanager.hh"
+#include "G4UImessenger.hh"
+#include "G4UserRunAction.hh"
+#include "G4VUserActionInitialization.hh"
+#include "G4VUserDetectorConstruction.hh"
+#include "G4VUserPrimaryGeneratorAction.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#define CHEMBENCH_MODELS
+#endif
+
+// NOTE(SO): referenced by the chem6 sources (RunAction, ScoreSpecies)
+std::ofstream out;
+long nProcessedEvents = 0;
+double processingTime = 0.;
+
+namespace {
+
+//==============================================================================
+// configuration of the species sets, set on the master before the run
+//==============================================================================
+struct BenchConfig {
+  G4String source = "uniform";  // uniform, track, file
+  G4int nmolecules = 1000;
+  G4double size = 1. * um;
+  G4double let = 10. * keV / um;
+  G4double length = 1. * um;
+  G4double radius = 2. * nm;
+  G4String file = "SpeciesSet.txt";
+};
+
+BenchConfig config;
+
+// results of the last run (master)
+struct BenchResult {
+  long events = 0;
+  double molecules = 0.;
+  double reactions = 0.;
+  double elapsed = 0.;    // wall (s)
+  double chemistry = 0.;  // chemistry stage summed over the threads (s)
+  double peak_rss = 0.;   // MB
+};
+
+BenchResult result;
+
+//==============================================================================
+class BenchMessenger : public G4UImessenger {
+public:
+  BenchMessenger();
+  ~BenchMessenger() override;
+
+  void SetNewValue(G4UIcommand* cmd, G4String val) override;
+
+private:
+  G4UIdirectory* dir_{nullptr};
+  G4UIcmdWithAString* source_cmd_{nullptr};
+  G4UIcmdWithAnInteger* nmolecules_cmd_{nullptr};
+  G4UIcmdWithADoubleAndUnit* size_cmd_{nullptr};
+  G4UIcmdWithADouble* let_cmd_{nullptr};
+  G4UIcmdWithADoubleAndUnit* length_cmd_{nullptr};
+  G4UIcmdWithADoubleAndUnit* radius_cmd_{nullptr};
+  G4UIcmdWithAString* file_cmd_{nullptr};
+};
+
+//------------------------------------------------------------------------------
+BenchMessenger::BenchMessenger()
+{
+  dir_ = new G4UIdirectory("/chembench/");
+  dir_->SetGuidance("Species sets of the chemistry benchmark");
+
+  source_cmd_ = new G4UIcmdWithAString("/chembench/source", this);
+  source_cmd_->SetGuidance("Species injected in each event: uniform (cube),");
+  source_cmd_->SetGuidance("track (track core of a given LET) or file");
+  source_cmd_->SetGuidance("(species sets recorded by chem6)");
+  source_cmd_->SetParameterName("source", false);
+  source_cmd_->SetCandidates("uniform track file");
+
+  nmolecules_cmd_ = new G4UIcmdWithAnInteger("/chembench/nMolecules", this);
+  nmolecules_cmd_->SetGuidance("Number of species of the uniform set");
+  nmolecules_cmd_->SetParameterName("n", false);
+  nmolecules_cmd_->SetRange("n > 0");
+
+  size_cmd_ = new G4UIcmdWithADoubleAndUnit("/chembench/size", this);
+  size_cmd_->SetGuidance("Side of the cube of the uniform set");
+  size_cmd_->SetParameterName("size", false);
+  size_cmd_->SetRange("size > 0");
+  size_cmd_->SetUnitCategory("Length");
+
+  let_cmd_ = new G4UIcmdWithADouble("/chembench/LET", this);
+  let_cmd_->SetGuidance("LET of the track core (keV/um)");
+  let_cmd_->SetParameterName("LET", false);
+  let_cmd_->SetRange("LET > 0");
+
+  length_cmd_ = new G4UIcmdWithADoubleAndUnit("/chembench/trackLength", this);
+  length_cmd_->SetGuidance("Length of the track core");
+  length_cmd_->SetParameterName("length", false);
+  length_cmd_->SetRange("length > 0");
+  length_cmd_->SetUnitCategory("Length");
+
+  radius_cmd_ = new G4UIcmdWithADoubleAndUnit("/chembench/coreRadius", this);
+  radius_cmd_->SetGuidance("Standard deviation of the radial profile of the core");
+  radius_cmd_->SetParameterName("radius", false);
+  radius_cmd_->SetRange("radius > 0");
+  radius_cmd_->SetUnitCategory("Length");
+
+  file_cmd_ = new G4UIcmdWithAString("/chembench/file", this);
+  file_cmd_->SetGuidance("Species sets written by chem6 (/scorer/species/speciesSet),");
+  file_cmd_->SetGuidance("the events cycle over the sets of the file");
+  file_cmd_->SetParameterName("file", false);
+
+  for (auto* cmd : std::vector<G4UIcommand*>{source_cmd_, nmolecules_cmd_, size_cmd_,
+                                             let_cmd_, length_cmd_, radius_cmd_,
+                                             file_cmd_}) {
+    cmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+    cmd->SetToBeBroadcasted(false);
+  }
+}
+
+//------------------------------------------------------------------------------
+BenchMessenger::~BenchMessenger()
+{
+  delete source_cmd_;
+  delete nmolecules_cmd_;
+  delete size_cmd_;
+  delete let_cmd_;
+  delete length_cmd_;
+  delete radius_cmd_;
+  delete file_cmd_;
+  delete dir_;
+}
+
+//------------------------------------------------------------------------------
+void BenchMessenger::SetNewValue(G4UIcommand* cmd, G4String val)
+{
+  if (cmd == source_cmd_) { config.source = val; }
+  if (cmd == nmolecules_cmd_) {
+    config.nmolecules = nmolecules_cmd_->GetNewIntValue(val);
+  }
+  if (cmd == size_cmd_) { config.size = size_cmd_->GetNewDoubleValue(val); }
+  if (cmd == let_cmd_) {
+    config.let = let_cmd_->GetNewDoubleValue(val) * keV / um;
+  }
+  if (cmd == length_cmd_) {
+    config.length = length_cmd_->GetNewDoubleValue(val);
+  }
+  if (cmd == radius_cmd_) {
+    config.radius = radius_cmd_->GetNewDoubleValue(val);
+  }
+  if (cmd == file_cmd_) { config.file = val; }
+}
+
+//==============================================================================
+// water box, no scorer
+//==============================================================================
+class BenchWorld : public G4VUserDetectorConstruction {
+public:
+  G4VPhysicalVolume* Construct() override
+  {
+    auto* water = G4NistManager::Instance()->FindOrBuildMaterial("G4_WATER");
+    const G4double half = 500. * um;
+    auto* solid = new G4Box("World", half, half, half);
+    auto* logical = new G4LogicalVolume(solid, water, "World");
+    return new G4PVPlacement(nullptr, G4ThreeVector(), logical, "World",
+                             nullptr, false, 0);
+  }
+};
+
+//==============================================================================
+class BenchRun : public G4Run {
+public:
+  void Merge(const G4Run* run) override
+  {
+    auto* local = static_cast<const BenchRun*>(run);
+    molecules_ += local->molecules_;
+    reactions_ += local->reactions_;
+    G4Run::Merge(run);
+  }
+
+  void AddMolecules(G4int n) { molecules_ += n; }
+  void AddReaction() { reactions_++; }
+
+  double GetMolecules() const { return molecules_; }
+  double GetReactions() const { return reactions_; }
+
+private:
+  double molecules_{0.};
+  double reactions_{0.};
+};
+
+//------------------------------------------------------------------------------
+BenchRun* GetCurrentRun()
+{
+  return static_cast<BenchRun*>(
+    G4RunManager::GetRunManager()->GetNonConstCurrentRun());
+}
+
+//==============================================================================
+// injects the species set of the event, the chemical stage is started by
+// the stacking action as in chem6
+//==============================================================================
+class BenchGenerator : public G4VUserPrimaryGeneratorAction {
+public:
+  void GeneratePrimaries(G4Event* event) override;
+
+private:
+  std::vector<MI::SpeciesSet> sets_;  // recorded sets (file)
+  G4bool warned_{false};
+};
+
+//------------------------------------------------------------------------------
+void BenchGenerator::GeneratePrimaries(G4Event* event)
+{
+  MI::SpeciesSet generated;
+  const MI::SpeciesSet* set = &generated;
+  if (config.source == "file") {
+    if (sets_.empty()) { sets_ = MI::ReadSpeciesSets(config.file); }
+    if (sets_.empty()) { return; }
+    set = &sets_[event->GetEventID() % sets_.size()];
+  }
+  else if (config.source == "track") {
+    generated = MI::MakeTrackSpeciesSet(config.let, config.length, config.radius);
+  }
+  else {
+    generated = MI::MakeUniformSpeciesSet(config.nmolecules, config.size);
+  }
+
+  auto* table = G4MoleculeTable::Instance();
+  auto* chemistry = G4DNAChemistryManager::Instance();
+  G4int n = 0;
+  for (const auto& entry : *set) {
+    auto* species = table->GetConfiguration(entry.species, false);
+    if (species == nullptr) {
+      if (!warned_) {
+        G4Exception("BenchGenerator::GeneratePrimaries", "MI_CHEMBENCH_001",
+                    JustWarning, ("Unknown species (skipped): " + entry.species).c_str());
+        warned_ = true;
+      }
+      continue;
+    }
+    chemistry->PushMolecule(std::make_unique<G4Molecule>(species), entry.time,
+                            entry.position, -1);
+    n++;
+  }
+  GetCurrentRun()->AddMolecules(n);
+}
+
+//==============================================================================
+class BenchTimeStepAction : public TimeStepAction {
+public:
+  void UserReactionAction(const G4Track&, const G4Track&,
+                          const std::vector<G4Track*>*) override
+  {
+    GetCurrentRun()->AddReaction();
+  }
+};
+
+//==============================================================================
+class BenchRunAction : public G4UserRunAction {
+public:
+  G4Run* GenerateRun() override { return new BenchRun(); }
+
+  void BeginOfRunAction(const G4Run*) override
+  {
+    if (!IsMaster()) return;
+    auto* timer = TimeHistory::GetTimeHistory();
+    timer->ResetStages();
+    timer->TakeSplit("RunOn");
+  }
+
+  void EndOfRunAction(const G4Run* run) override;
+};
+
+//------------------------------------------------------------------------------
+void BenchRunAction::EndOfRunAction(const G4Run* run)
+{
+  if (!IsMaster() || run->GetNumberOfEvent() == 0) return;
+
+  auto* timer = TimeHistory::GetTimeHistory();
+  timer->TakeSplit("RunEnd");
+  const auto* benchRun = static_cast<const BenchRun*>(run);
+  const auto chemistry = timer->GetStageRecords()[TimeHistory::kChemistry];
+
+  result.events = run->GetNumberOfEvent();
+  result.molecules = benchRun->GetMolecules();
+  result.reactions = benchRun->GetReactions();
+  result.elapsed = timer->GetTime("RunEnd") - timer->GetTime("RunOn");
+  result.chemistry = chemistry.total;
+  result.peak_rss = MI::GetPeakResidentMemory();
+
+  G4cout << "\n=============================================" << G4endl;
+  G4cout << " Chemistry Benchmark (" << config.source << ")" << G4endl;
+  G4cout << " - Event Number:      " << result.events << G4endl;
+  G4cout << " - Species / event:   " << result.molecules / result.events << G4endl;
+  G4cout << " - Reactions / event: " << result.reactions / result.events << G4endl;
+  G4cout << " - Elapsed Time:      " << result.elapsed << " (sec)" << G4endl;
+  G4cout << " - Throughput:        " << result.events / result.elapsed * 60.
+         << " (events/min.)" << G4endl;
+  if (chemistry.count > 0) {
+    G4cout << " - Chemistry / event: " << result.chemistry / chemistry.count * 1e3
+           << " (ms, per thread)" << G4endl;
+    G4cout << " - Reactions / sec:   " << result.reactions / result.chemistry
+           << " (per thread)" << G4endl;
+  }
+  G4cout << " - Peak RSS:          " << result.peak_rss << " (MB)" << G4endl;
+  G4cout << "=============================================" << G4endl;
+}
+
+//==============================================================================
+class BenchActionInitialization : public G4VUserActionInitialization {
+public:
+  void BuildForMaster() const override { SetUserAction(new BenchRunAction()); }
+
+  void Build() const override
+  {
+    SetUserAction(new BenchGenerator());
+    SetUserAction(new BenchRunAction());
+    SetUserAction(new StackingAction());
+    G4Scheduler::Instance()->SetUserAction(new BenchTimeStepAction());
+  }
+};
+
+//------------------------------------------------------------------------------
+// NOTE(SO): the macro selects the time-step model with
+// "/process/chem/TimeStepModel {timeStepModel}", the alias is the model of
+// the command line (IRT by default)
+void Execute(const G4String& macro, const G4String& model = "IRT")
+{
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+
+  auto* runManager = G4RunManagerFactory::CreateRunManager();
+  runManager->SetUserInitialization(new PhysicsList());
+  runManager->SetUserInitialization(new BenchWorld());
+  runManager->SetUserInitialization(new BenchActionInitialization());
+
+  auto* messenger = new BenchMessenger();
+
+  auto* UI = G4UImanager::GetUIpointer();
+  UI->ApplyCommand("/control/alias timeStepModel " + model);
+  UI->ApplyCommand("/control/execute " + macro);
+  delete messenger;
+
+  delete runManager;
+}
+
+#ifdef CHEMBENCH_MODELS
+//------------------------------------------------------------------------------
+// a model set by the macro itself would override the one of the command line
+bool SetsTimeStepModel(const G4String& macro)
+{
+  std::ifstream in(macro);
+  std::string line;
+  while (std::getline(in, line)) {
+    auto start = line.find_first_not_of(" \t");
+    if (start == std::string::npos || line[start] == '#') { continue; }
+    if (line.compare(start, 27, "/process/chem/TimeStepModel") == 0
+        && line.find("{timeStepModel}") == std::string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// NOTE(SO): the time-step model cannot be changed once the chemistry is
+// initialised, so each model runs in a forked process (as the combinations
+// of chem6). The results of the last run go back through a pipe.
+bool RunModels(const G4String& macro, int nmodels, char** models)
+{
+  if (SetsTimeStepModel(macro)) {
+    G4cerr << macro << " sets the time-step model, use" << G4endl
+           << "  /process/chem/TimeStepModel {timeStepModel}" << G4endl
+           << "to compare the models of the command line." << G4endl;
+    return false;
+  }
+
+  std::vector<std::string> lines;
+  for (int i = 0; i < nmodels; i++) {
+    G4String model = models[i];
+
+    int fd[2];
+    if (pipe(fd) != 0) {
+      G4cerr << "pipe() failed for " << model << G4endl;
+      continue;
+    }
+    G4cout.flush();
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      close(fd[0]);
+      Execute(macro, model);
+
+      char line[512];
+      auto n = std::snprintf(
+        line, sizeof(line), "%-10s %8ld %12.1f %12.1f %14.2f %14.4g %10.1f",
+        model.c_str(), result.events,
+        result.events > 0 ? result.molecules / result.events : 0.,
+        result.events > 0 ? result.reactions / result.events : 0.,
+        result.events > 0 ? result.chemistry / result.events * 1e3 : 0.,
+        result.chemistry > 0. ? result.reactions / result.chemistry : 0.,
+        result.peak_rss);
+      if (write(fd[1], line, n) < 0) { _exit(1); }
+      close(fd[1]);
+      _exit(0);
+    }
+
+    close(fd[1]);
+    char buffer[512];
+    std::string line;
+    ssize_t n;
+    while ((n = read(fd[0], buffer, sizeof(buffer))) > 0) {
+      line.append(buffer, n);
+    }
+    close(fd[0]);
+    int status = 0;
+    if (pid > 0) { waitpid(pid, &status, 0); }
+    if (pid < 0 || line.empty() || status != 0) {
+      line = model;
+      line.resize(10, ' ');
+      line += " failed";
+    }
+    lines.push_back(line);
+  }
+
+  G4cout << "\n=============================================" << G4endl;
+  G4cout << " Time-Step Model Summary (last run of each model)" << G4endl;
+  char header[512];
+  std::snprintf(header, sizeof(header), "%-10s %8s %12s %12s %14s %14s %10s",
+                "model", "events", "species/evt", "reactions/evt", "chem. ms/evt",
+                "reactions/s", "RSS (MB)");
+  G4cout << header << G4endl;
+  for (const auto& line : lines) {
+    G4cout << line << G4endl;
+  }
+  G4cout << "=============================================" << G4endl;
+  return true;
+}
+#endif
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  TimeHistory::GetTimeHistory()->TakeSplit("Start");
+
+  if (argc < 2) {
+    G4cerr << "usage: chem6_chembench macro [time-step model ...]" << G4endl;
+    return 1;
+  }
+
+  if (argc > 2) {
+#ifdef CHEMBENCH_MODELS
+    if (!RunModels(argv[1], argc - 2, argv + 2)) { return 1; }
+#else
+    G4cerr << "Several models are not supported on this platform." << G4endl;
+    return 1;
+#endif
+  }
+  else {
+    Execute(argv[1]);
+  }
+  return 0;
+}
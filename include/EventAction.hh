@@ -38,15 +38,42 @@
 #ifndef EventAction_hh
 #define EventAction_hh 1
 
+#include "memory_tracker.hh"
+#include "memory_usage.hh"
+#include "metrics_exporter.hh"
+#include "startup_profiler.hh"
+#include "timehistory.hh"
+
 #include "G4DNAChemistryManager.hh"
+#include "G4Threading.hh"
 #include "G4UserEventAction.hh"
 #include "G4Version.hh"
 
+#include <string>
+
 class EventAction : public G4UserEventAction
 {
   public:
     void BeginOfEventAction(const G4Event* event) override
     {
+      // NOTE(SO): startup cost of this thread
+      if (fFirstEvent) {
+        fFirstEvent = false;
+        MI::StartupProfiler::Instance()->End("thread spin-up");
+        auto* timer = TimeHistory::GetTimeHistory();
+        auto key = "FirstEvent_t" + std::to_string(G4Threading::G4GetThreadId());
+        timer->TakeSplit(key);
+        G4cout << "[Startup] thread " << G4Threading::G4GetThreadId()
+               << ": first event after " << timer->GetTime(key) - timer->GetTime("Start")
+               << " s, RSS " << MI::GetResidentMemory() << " MB (peak "
+               << MI::GetPeakResidentMemory() << " MB)" << G4endl;
+      }
+      // waits while the live memory is above the soft cap (/perf/memory/softCapMB)
+      MI::MemoryTracker::Instance()->BeginEvent();
+      MI::MetricsExporter::Instance()->BeginEvent();
+      auto* timer = TimeHistory::GetTimeHistory();
+      timer->BeginStage(TimeHistory::kEvent);
+      timer->BeginStage(TimeHistory::kPhysics);  // ended by StackingAction
 #if G4VERSION_NUMBER >= 1140
       if (G4DNAChemistryManager::GetInstanceIfExists() != nullptr)
         G4DNAChemistryManager::Instance()->BeginOfEventAction(event);
@@ -54,11 +81,17 @@ class EventAction : public G4UserEventAction
     }
     void EndOfEventAction(const G4Event* event) override
     {
+      TimeHistory::GetTimeHistory()->EndStage(TimeHistory::kEvent);
+      MI::MemoryTracker::Instance()->EndEvent();
+      MI::MetricsExporter::Instance()->EndEvent(event->IsAborted());
 #if G4VERSION_NUMBER >= 1140
       if (G4DNAChemistryManager::GetInstanceIfExists() != nullptr)
         G4DNAChemistryManager::Instance()->EndOfEventAction(event);
 #endif
     }
+
+  private:
+    G4bool fFirstEvent{true};
 };
 
 #endif
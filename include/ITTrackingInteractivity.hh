@@ -0,0 +1,82 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// This example is provided by the Geant4-DNA collaboration
+// chem6 example is derived from chem4 and chem5 examples
+//
+// Any report or published results obtained using the Geant4-DNA software
+// shall cite the following Geant4-DNA collaboration publication:
+// J. Appl. Phys. 125 (2019) 104301
+// Med. Phys. 45 (2018) e722-e739
+// J. Comput. Phys. 274 (2014) 841-882
+// Med. Phys. 37 (2010) 4692-4708
+// Int. J. Model. Simul. Sci. Comput. 1 (2010) 157-178
+// The Geant4-DNA web site is available at http://geant4-dna.org
+//
+// Authors: W. G. Shin and S. Incerti (CENBG, France)
+//
+// $Id$
+//
+/// \file ITTrackingInteractivity.hh
+/// \brief Definition of the ITTrackingInteractivity class
+
+#ifndef CHEM6_ITTrackingInteractivity_h
+#define CHEM6_ITTrackingInteractivity_h 1
+
+#include "G4ITTrackingInteractivity.hh"
+
+#include <unordered_set>
+
+class G4Track;
+
+/**
+ * Counts the chemical species where they appear and disappear: a track is
+ * created (+1) when the scheduler starts tracking it (pre-chemistry
+ * species, products of the water dissociation and of the reactions) and
+ * destroyed (-1) when it ends tracking killed (dissociated water molecules,
+ * reactants). The changes feed the reaction log and the live species of
+ * the memory tracker.
+ */
+class ITTrackingInteractivity : public G4ITTrackingInteractivity
+{
+  public:
+    ITTrackingInteractivity() = default;
+    ~ITTrackingInteractivity() override = default;
+
+    void StartTracking(G4Track*) override;
+    void EndTracking(G4Track*) override;
+
+    /** Start a new chemical stage*/
+    void Clear();
+
+    long GetLiveSpecies() const { return fLiveSpecies; }
+
+  private:
+    // tracks counted as created and not destroyed yet
+    std::unordered_set<const G4Track*> fTracks;
+    long fLiveSpecies{0};
+};
+
+#endif  // CHEM6_ITTrackingInteractivity_h
@@ -50,6 +50,10 @@
 #include "G4UImessenger.hh"
 #include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithABool.hh"
+#include "dna_scavenger.hh"
+
+#include <set>
+#include <sstream>
 
 class G4VPhysicsConstructor;
 class PhysicsListMessenger;
@@ -63,13 +67,37 @@ class PhysicsList : public G4VModularPhysicsList
 
     void ConstructParticle() override;
     void ConstructProcess() override;
+    void SetCuts() override;
 
     void RegisterConstructor(const G4String& name);
 
     void SetMultipleIonisation(G4bool in);
 
+    void SetBatchedDisplacer(G4bool in) { fBatchedDisplacer = in; }
+
+    // water decay channels sampled from alias tables
+    void SetDecayDispatch(G4bool in) { fDecayDispatch = in; }
+
+    // particles given multiple ionisation processes (all if none is given)
+    void AddMultipleIonisationParticle(const G4String& name);
+
+    // thermalisation distance tables: "off", "on" or "validate"
+    void SetSolvationTable(const G4String& mode) { fSolvationTable = mode; }
+
+    // physics table cache, keyed by the Geant4 version and the physics
+    // configuration in a sub-directory of dir
+    void SetTableCache(const G4String& dir) { fTableCacheDir = dir; }
+    // store the tables built at the first run, if not retrieved
+    void StoreTableCache();
+
+    void AddScavenger(const MI::DNAScavenger& scavenger);
+
   private:
     void ConstructMultipleIonisationProcess();
+    void InstallBatchedDisplacer();
+    void InstallDecayDispatch();
+    G4String GetTableCacheDirectory() const;
+    void InstallSolvationTable();
 
   private:
     std::unique_ptr<G4VPhysicsConstructor> fEmDNAPhysicsList;
@@ -77,6 +105,13 @@ class PhysicsList : public G4VModularPhysicsList
     G4String fPhysDNAName{""};
     G4String fChemDNAName{""};
     G4bool fMIoni{false};
+    G4bool fBatchedDisplacer{false};
+    G4bool fDecayDispatch{false};
+    std::set<G4String> fMIParticles;
+    G4String fSolvationTable{"off"};
+    G4String fTableCacheDir{""};
+    G4bool fTableCacheToStore{false};
+    G4String fTableCacheStoreDir{""};  // key taken at the construction
     PhysicsListMessenger* pMessenger;
 };
 
@@ -97,6 +132,84 @@ public:
     mioni_cmd_ = new G4UIcmdWithABool("/physlist/multiple_ionisation", this);
     mioni_cmd_->SetGuidance("Set multiple ionization processes");
     mioni_cmd_->SetDefaultValue(false);
+
+    phys_cmd_ = new G4UIcmdWithAString("/physlist/dna/physics", this);
+    phys_cmd_->SetGuidance("Select the Geant4-DNA physics constructor");
+    phys_cmd_->SetParameterName("name", false);
+    phys_cmd_->SetCandidates("G4EmDNAPhysics G4EmDNAPhysics_option1 "
+                             "G4EmDNAPhysics_option2 G4EmDNAPhysics_option3 "
+                             "G4EmDNAPhysics_option4 G4EmDNAPhysics_option5 "
+                             "G4EmDNAPhysics_option6 G4EmDNAPhysics_option7 "
+                             "G4EmDNAPhysics_option8");
+    phys_cmd_->AvailableForStates(G4State_PreInit);
+    phys_cmd_->SetToBeBroadcasted(false);
+
+    chem_cmd_ = new G4UIcmdWithAString("/physlist/dna/chemistry", this);
+    chem_cmd_->SetGuidance("Select the Geant4-DNA chemistry constructor");
+    chem_cmd_->SetParameterName("name", false);
+    chem_cmd_->SetCandidates("G4EmDNAChemistry G4EmDNAChemistry_option1 "
+                             "G4EmDNAChemistry_option2 G4EmDNAChemistry_option3");
+    chem_cmd_->AvailableForStates(G4State_PreInit);
+    chem_cmd_->SetToBeBroadcasted(false);
+
+    mioni_particles_cmd_ =
+      new G4UIcmdWithAString("/physlist/multiple_ionisation_particles", this);
+    mioni_particles_cmd_->SetGuidance("Restrict the multiple ionisation");
+    mioni_particles_cmd_->SetGuidance("processes to the given particles");
+    mioni_particles_cmd_->SetGuidance("(proton, alpha, GenericIon); the");
+    mioni_particles_cmd_->SetGuidance("hydrogen atoms follow the protons.");
+    mioni_particles_cmd_->SetGuidance("All of them are used by default.");
+    mioni_particles_cmd_->SetParameterName("particles", false);
+    mioni_particles_cmd_->AvailableForStates(G4State_PreInit);
+    mioni_particles_cmd_->SetToBeBroadcasted(false);
+
+    scavenger_cmd_ = new G4UIcmdWithAString("/physlist/scavenger", this);
+    scavenger_cmd_->SetGuidance("Add a pseudo-first-order scavenger reaction");
+    scavenger_cmd_->SetGuidance("  reactant + scavenger -> products");
+    scavenger_cmd_->SetGuidance("The scavenger is not tracked as a molecule.");
+    scavenger_cmd_->SetGuidance("Parameters: reactant scavenger k[1/M/s] "
+                                "concentration[M] product1 product2 ...");
+    scavenger_cmd_->SetGuidance("e.g. /physlist/scavenger e_aq O2 1.9e10 2.5e-4 O2m");
+    scavenger_cmd_->AvailableForStates(G4State_PreInit);
+    scavenger_cmd_->SetToBeBroadcasted(false);
+
+    displacer_cmd_ = new G4UIcmdWithABool("/physlist/batched_displacer", this);
+    displacer_cmd_->SetGuidance("Sample the displacements of the products of");
+    displacer_cmd_->SetGuidance("multi-product water dissociation channels in");
+    displacer_cmd_->SetGuidance("one batch (Gaussian, calibrated RMS).");
+    displacer_cmd_->SetGuidance("Off unless enabled (default: false).");
+    displacer_cmd_->SetParameterName("flag", true);
+    displacer_cmd_->SetDefaultValue(false);
+    displacer_cmd_->AvailableForStates(G4State_PreInit);
+    displacer_cmd_->SetToBeBroadcasted(false);
+
+    dispatch_cmd_ = new G4UIcmdWithABool("/physlist/decay_dispatch", this);
+    dispatch_cmd_->SetGuidance("Sample the decay channels of the excited and");
+    dispatch_cmd_->SetGuidance("ionised water molecules from alias tables");
+    dispatch_cmd_->SetGuidance("indexed by the configuration (default: false)");
+    dispatch_cmd_->SetParameterName("flag", false);
+    dispatch_cmd_->AvailableForStates(G4State_PreInit);
+    dispatch_cmd_->SetToBeBroadcasted(false);
+
+    solvation_cmd_ = new G4UIcmdWithAString("/physlist/solvation_table", this);
+    solvation_cmd_->SetGuidance("Sample the thermalisation distance of the");
+    solvation_cmd_->SetGuidance("electrons from inverse-CDF tables of the");
+    solvation_cmd_->SetGuidance("/process/dna/e-SolvationSubType model.");
+    solvation_cmd_->SetGuidance("validate: also compare the tabulated");
+    solvation_cmd_->SetGuidance("distances with the model at initialisation");
+    solvation_cmd_->SetParameterName("mode", false);
+    solvation_cmd_->SetCandidates("off on validate");
+    solvation_cmd_->AvailableForStates(G4State_PreInit);
+    solvation_cmd_->SetToBeBroadcasted(false);
+
+    table_cache_cmd_ = new G4UIcmdWithAString("/physlist/table_cache", this);
+    table_cache_cmd_->SetGuidance("Cache the physics tables in a directory");
+    table_cache_cmd_->SetGuidance("The tables are stored at the first launch");
+    table_cache_cmd_->SetGuidance("and retrieved at the later ones with the");
+    table_cache_cmd_->SetGuidance("same Geant4 version and physics lists.");
+    table_cache_cmd_->SetParameterName("dir", false);
+    table_cache_cmd_->AvailableForStates(G4State_PreInit);
+    table_cache_cmd_->SetToBeBroadcasted(false);
   }
 
   //----------------------------------------------------------------------------
@@ -104,6 +217,14 @@ public:
   ~PhysicsListMessenger() override
   {
     if (mioni_cmd_) { delete mioni_cmd_; }
+    if (phys_cmd_) { delete phys_cmd_; }
+    if (chem_cmd_) { delete chem_cmd_; }
+    if (mioni_particles_cmd_) { delete mioni_particles_cmd_; }
+    if (scavenger_cmd_) { delete scavenger_cmd_; }
+    if (displacer_cmd_) { delete displacer_cmd_; }
+    if (dispatch_cmd_) { delete dispatch_cmd_; }
+    if (solvation_cmd_) { delete solvation_cmd_; }
+    if (table_cache_cmd_) { delete table_cache_cmd_; }
   }
 
   //----------------------------------------------------------------------------
@@ -112,11 +233,53 @@ public:
     if (cmd == mioni_cmd_) {
       plist_->SetMultipleIonisation(mioni_cmd_->GetNewBoolValue(val));
     }
+    if (cmd == phys_cmd_ || cmd == chem_cmd_) {
+      plist_->RegisterConstructor(val);
+    }
+    if (cmd == mioni_particles_cmd_) {
+      std::istringstream is(val);
+      G4String name;
+      while (is >> name) { plist_->AddMultipleIonisationParticle(name); }
+    }
+    if (cmd == scavenger_cmd_) {
+      MI::DNAScavenger scavenger;
+      std::istringstream is(val);
+      is >> scavenger.reactant >> scavenger.scavenger
+         >> scavenger.rate_constant >> scavenger.concentration;
+      if (is.fail()) {
+        G4Exception("PhysicsListMessenger::SetNewValue", "MI_SCAVENGER_000",
+                    FatalErrorInArgument, ("Invalid scavenger: " + val).c_str());
+        return;
+      }
+      G4String product;
+      while (is >> product) { scavenger.products.push_back(product); }
+      plist_->AddScavenger(scavenger);
+    }
+    if (cmd == displacer_cmd_) {
+      plist_->SetBatchedDisplacer(displacer_cmd_->GetNewBoolValue(val));
+    }
+    if (cmd == dispatch_cmd_) {
+      plist_->SetDecayDispatch(dispatch_cmd_->GetNewBoolValue(val));
+    }
+    if (cmd == solvation_cmd_) {
+      plist_->SetSolvationTable(val);
+    }
+    if (cmd == table_cache_cmd_) {
+      plist_->SetTableCache(val);
+    }
   }
 
 private:
   PhysicsList* plist_{nullptr};
   G4UIcmdWithABool* mioni_cmd_{nullptr};
+  G4UIcmdWithAString* phys_cmd_{nullptr};
+  G4UIcmdWithAString* chem_cmd_{nullptr};
+  G4UIcmdWithAString* mioni_particles_cmd_{nullptr};
+  G4UIcmdWithAString* scavenger_cmd_{nullptr};
+  G4UIcmdWithABool* displacer_cmd_{nullptr};
+  G4UIcmdWithABool* dispatch_cmd_{nullptr};
+  G4UIcmdWithAString* solvation_cmd_{nullptr};
+  G4UIcmdWithAString* table_cache_cmd_{nullptr};
 };
 
 #endif
@@ -46,10 +46,15 @@
 #define CHEM6_Run_h 1
 
 #include "ScoreSpecies.hh"
+#include "latency_histogram.hh"
+#include "timehistory.hh"
 
 #include "G4Run.hh"
 #include "G4THitsMap.hh"
 
+#include <array>
+#include <vector>
+
 /// Run class
 ///
 /// In RecordEvent() there is collected information event per event
@@ -67,12 +72,34 @@ class Run : public G4Run
     G4double GetSumDose() const { return fSumEne; }
     G4VPrimitiveScorer* GetPrimitiveScorer() const { return fScorerRun; }
     G4THitsMap<G4double>* GetLET() { return fTotalLET; }
+    const std::vector<G4long>& GetReactionCounts() const { return fReactionCounts; }
+
+    // per-event wall and CPU time of each stage, see TimeHistory::Stage
+    using StageHistograms = std::array<MI::LatencyHistogram, TimeHistory::kNStages>;
+    const StageHistograms& GetStageWallTimes() const { return fStageWall; }
+    const StageHistograms& GetStageCPUTimes() const { return fStageCPU; }
+
+    // peak resident memory sampled at the end of each event (MB)
+    G4double GetPeakRSS() const { return fPeakRSS; }
+    // peak number of live chemical species per event: maximum and mean
+    long GetPeakSpecies() const { return fPeakSpecies; }
+    G4double GetMeanPeakSpecies() const
+    {
+      return fNChemistryEvents > 0 ? fSumPeakSpecies / fNChemistryEvents : 0.;
+    }
 
   private:
     G4double fSumEne;
     G4VPrimitiveScorer* fScorerRun;
     G4VPrimitiveScorer* fLETScorerRun;
     G4THitsMap<G4double>* fTotalLET;
+    std::vector<G4long> fReactionCounts;  // see MI::ReactionCounter
+    StageHistograms fStageWall;
+    StageHistograms fStageCPU;
+    G4double fPeakRSS{0.};
+    long fPeakSpecies{0};
+    G4double fSumPeakSpecies{0.};
+    long fNChemistryEvents{0};
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -46,10 +46,13 @@
 #define CHEM6_ScoreSpecies_h 1
 
 #include "G4THitsMap.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UImessenger.hh"
 #include "G4VPrimitiveScorer.hh"
+#include "homogeneous_kinetics.hh"
 
 #include <set>
 
@@ -79,6 +82,14 @@ class ScoreSpecies : public G4VPrimitiveScorer, public G4UImessenger
     /**  Remove all times to record, must be reset by user.*/
     inline void ClearTimeToRecord() { fTimeToRecord.clear(); }
 
+    /** Add the log-spaced times of /scorer/species/nOfTimeBins, up to the
+        end time of the run. Called at the beginning of each run.*/
+    void BuildTimeGrid();
+
+    /** Hand the species counts over to the homogeneous kinetics solver
+        at this time. Times to record beyond it are computed by the solver.*/
+    inline void SetHandoffTime(double time) { fHandoffTime = time; }
+
     /** Get number of recorded events*/
     inline int GetNumberOfRecordedEvents() const { return fNEvent; }
 
@@ -119,10 +130,24 @@ class ScoreSpecies : public G4VPrimitiveScorer, public G4UImessenger
     SpeciesMap fSpeciesInfoPerTime;
 
     std::set<G4double> fTimeToRecord;
+    std::set<G4double> fTimeGrid;  // times added by BuildTimeGrid
+
+    void AccumulateSpecies(Species* species, double time, double n_mol);
+    void SolveHomogeneousKinetics(const std::map<Species*, double>& nAtHandoff);
+    void CountFromReactionLog();
+    void CheckReactionLog(const std::map<double, std::map<Species*, double>>& counts) const;
 
     int fNEvent;  // number of processed events
     double fEdep;  // total energy deposition
     G4String fOutputType;  // output type
+    G4bool fCheckReactionLog;  // compare the log with the molecule counter
+
+    G4double fHandoffTime;  // IRT to homogeneous kinetics hand-off time
+    G4double fKineticsDose;  // dose used to convert G values to concentrations
+    G4double fKineticsEndTime;  // end of the homogeneous stage
+    G4int fKineticsRunID;  // run for which the reaction network was built
+    G4int fNOfTimeBins;  // log-spaced times to record, 0 if none
+    MI::HomogeneousKinetics fKinetics;
 
   protected:
     virtual G4bool ProcessHits(G4Step*, G4TouchableHistory*);
@@ -148,5 +173,13 @@ class ScoreSpecies : public G4VPrimitiveScorer, public G4UImessenger
     G4UIdirectory* fSpeciesdir;
     G4UIcmdWithAnInteger* fTimeBincmd;
     G4UIcmdWithADoubleAndUnit* fAddTimeToRecordcmd;
+    G4UIcmdWithAString* fScoreSpeciescmd;
+    G4UIcmdWithAString* fReactionLogcmd;
+    G4UIcmdWithABool* fCheckReactionLogcmd;
+    G4UIcmdWithAString* fSpeciesSetcmd;
+    G4UIdirectory* fKineticsdir;
+    G4UIcmdWithADoubleAndUnit* fHandoffTimecmd;
+    G4UIcmdWithADoubleAndUnit* fKineticsDosecmd;
+    G4UIcmdWithADoubleAndUnit* fKineticsEndTimecmd;
 };
 #endif
@@ -55,7 +55,10 @@ class TimeStepAction : public G4UserTimeStepAction
     TimeStepAction(const TimeStepAction& other);
     TimeStepAction& operator=(const TimeStepAction& other);
 
-    virtual void StartProcessing() { ; }
+    /**
+     * Start the species count of the event (ITTrackingInteractivity)
+     */
+    virtual void StartProcessing();
 
     /** In this method, the user can use :
      * G4ITTimeStepper::Instance()->GetGlobalTime(),
@@ -76,6 +79,13 @@ class TimeStepAction : public G4UserTimeStepAction
 
     virtual void EndProcessing() { ; }
     void Clear();
+
+  private:
+    // species at the end of the pre-chemical stage (SpeciesSetWriter)
+    void RecordSpeciesSet();
+
+    // the pre-chemistry stage timer is open until the first time step ends
+    G4bool fPreChemistry{false};
 };
 
 #endif  // CHEM6_TimeStepAction_h
@@ -0,0 +1,126 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef CHEMISTRY_SNAPSHOT_H_
+#define CHEMISTRY_SNAPSHOT_H_
+
+#include "globals.hh"
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+class G4MolecularConfiguration;
+
+namespace MI {
+
+//==============================================================================
+// Immutable copy of the chemistry data used by the project classes: species
+// (diffusion coefficient, radius, charge, reactivity) indexed by molecule ID,
+// reactions in a flat array and a dense reactant-pair matrix of reaction
+// indices. It is rebuilt for each run (the reactions may be changed between
+// the runs), from the first non-empty reaction table seen at the beginning
+// of the run, and shared by all threads. It only removes the per-thread
+// copies that the reaction counter and the species filter used to build,
+// they now keep a pointer to it. The snapshots of the previous runs are
+// kept until exit.
+//
+// NOTE(SO): the Geant4 molecule and reaction tables are already
+// process-wide singletons; they are read, not replaced
+//==============================================================================
+class ChemistrySnapshot {
+public:
+  using Species = const G4MolecularConfiguration;
+
+  static constexpr int kMaxProducts = 4;
+
+  struct alignas(64) SpeciesData {
+    Species* species{nullptr};
+    G4double diffusion_coefficient{0.};
+    G4double radius{0.};
+    G4int charge{0};
+    bool reactive{false};
+  };
+
+  struct alignas(64) ReactionData {
+    G4int reactant1{-1};
+    G4int reactant2{-1};
+    G4int type{0};
+    G4int nproducts{0};
+    std::array<G4int, kMaxProducts> products{};
+    G4double rate_constant{0.};    // observed
+    G4double reaction_radius{0.};  // effective
+  };
+
+  // nullptr until built
+  static const ChemistrySnapshot* Get();
+
+  // build from the reaction table of the calling thread, if not yet built
+  // for the run
+  static void Build(G4int run_id);
+
+  // run for which the snapshot was built
+  G4int GetRunID() const { return run_id_; }
+
+  std::size_t GetNumberOfSpecies() const { return species_.size(); }
+  const SpeciesData& GetSpeciesData(G4int id) const { return species_[id]; }
+
+  bool IsReactive(Species* species) const;
+
+  std::size_t GetNumberOfReactions() const { return reactions_.size(); }
+  const ReactionData& GetReactionData(std::size_t i) const
+  {
+    return reactions_[i];
+  }
+  const G4String& GetReactionName(std::size_t i) const { return names_[i]; }
+
+  // index of the reaction between two species, -1 if none
+  G4int FindReaction(Species* reactant1, Species* reactant2) const;
+
+private:
+  ChemistrySnapshot() = default;
+  ~ChemistrySnapshot() = default;
+
+  static std::atomic<const ChemistrySnapshot*> instance_;
+
+  G4int run_id_{-1};
+
+  std::vector<SpeciesData> species_;     // [molecule ID]
+  std::vector<ReactionData> reactions_;
+  std::vector<G4String> names_;          // [reaction]
+  std::vector<G4int> matrix_;            // [ID1 * nspecies + ID2]
+};
+
+//------------------------------------------------------------------------------
+inline const ChemistrySnapshot* ChemistrySnapshot::Get()
+{
+  return instance_.load(std::memory_order_acquire);
+}
+
+} // end of namespace MI
+
+#endif // CHEMISTRY_SNAPSHOT_H_
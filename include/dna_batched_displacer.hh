@@ -0,0 +1,77 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef DNA_BATCHED_DISPLACER_H_
+#define DNA_BATCHED_DISPLACER_H_
+
+#include "G4DNAWaterDissociationDisplacer.hh"
+
+#include <map>
+#include <vector>
+
+namespace MI {
+
+//==============================================================================
+// Displacer of the water dissociation products that samples all the product
+// displacements of a multi-product channel (B1A1, double, triple and
+// quadruple ionisation) in one batch of Gaussian numbers.
+// Each product is displaced isotropically with a 3D Gaussian whose RMS is
+// tabulated per displacement type and product slot. The table is calibrated
+// on the first use of each type from the Geant4 displacer, with a private
+// random engine so that it does not draw from the event engine. The event
+// random sequence still changes: G4RandGauss caches the second Gaussian of
+// each pair across the engine swap, and the batch draws other numbers than
+// the Geant4 displacer.
+// The other displacement types are forwarded to the Geant4 displacer.
+//
+// NOTE(SO): opt-in (/physlist/batched_displacer). The RMS of each product is
+// kept, but the correlations between the product directions are not.
+//==============================================================================
+class DNABatchedDisplacer : public G4DNAWaterDissociationDisplacer {
+public:
+  DNABatchedDisplacer() = default;
+  ~DNABatchedDisplacer() override = default;
+
+  std::vector<G4ThreeVector> GetProductsDisplacement(
+    const G4MolecularDissociationChannel* channel) const override;
+
+  static bool IsBatched(DisplacementType type);
+
+  static constexpr int kMaxProducts = 8;
+  static constexpr int kNCalibrations = 5000;
+
+private:
+  const std::vector<G4double>& GetRMS(
+    const G4MolecularDissociationChannel* channel) const;
+
+  // [displacement type][product] RMS distance
+  mutable std::map<DisplacementType, std::vector<G4double>> rms_;
+};
+
+} // end of namespace MI
+
+#endif // DNA_BATCHED_DISPLACER_H_
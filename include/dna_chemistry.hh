@@ -40,13 +40,18 @@ class DNABaseChemistry {
 public:
   DNABaseChemistry()
     : use_alt_B1A1_decay_{true},
-      use_alt_decay_vibH2O_{true} {}
+      use_alt_decay_vibH2O_{true},
+      use_multiple_ionisation_{true} {}
   ~DNABaseChemistry() = default;
   void UseAltB1A1Decay(bool in);
   void UseAltDecayVibH2O(bool in);
+  // NOTE(SO): without multiple ionisation only the scavenger reactions
+  // are added to the Geant4 chemistry constructor
+  void UseMultipleIonisation(bool in);
 protected:
   bool use_alt_B1A1_decay_;
   bool use_alt_decay_vibH2O_;
+  bool use_multiple_ionisation_;
 };
 
 //------------------------------------------------------------------------------
@@ -61,12 +66,19 @@ inline void DNABaseChemistry::UseAltDecayVibH2O(bool in)
   use_alt_decay_vibH2O_ = in;
 }
 
+//------------------------------------------------------------------------------
+inline void DNABaseChemistry::UseMultipleIonisation(bool in)
+{
+  use_multiple_ionisation_ = in;
+}
+
 //==============================================================================
 class DNAChemistry : public DNABaseChemistry,
                      public G4EmDNAChemistry {
 public:
   using G4EmDNAChemistry::G4EmDNAChemistry;
   void ConstructDissociationChannels() override;
+  void ConstructReactionTable(G4DNAMolecularReactionTable* table) override;
 };
 
 //==============================================================================
@@ -75,6 +87,7 @@ class DNAChemistryOpt1 : public DNABaseChemistry,
 public:
   using G4EmDNAChemistry_option1::G4EmDNAChemistry_option1;
   void ConstructDissociationChannels() override;
+  void ConstructReactionTable(G4DNAMolecularReactionTable* table) override;
 };
 
 //==============================================================================
@@ -83,6 +96,7 @@ class DNAChemistryOpt2 : public DNABaseChemistry,
 public:
   using G4EmDNAChemistry_option2::G4EmDNAChemistry_option2;
   void ConstructDissociationChannels() override;
+  void ConstructReactionTable(G4DNAMolecularReactionTable* table) override;
 };
 
 //==============================================================================
@@ -91,6 +105,7 @@ class DNAChemistryOpt3 : public DNABaseChemistry,
 public:
   using G4EmDNAChemistry_option3::G4EmDNAChemistry_option3;
   void ConstructDissociationChannels() override;
+  void ConstructReactionTable(G4DNAMolecularReactionTable* table) override;
 };
 
 } // end of namespace MI
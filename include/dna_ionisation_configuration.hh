@@ -0,0 +1,112 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef DNA_IONISATION_CONFIGURATION_H_
+#define DNA_IONISATION_CONFIGURATION_H_
+
+#include "G4MolecularDissociationChannel.hh"
+#include "globals.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+class G4ElectronOccupancy;
+class G4MolecularConfiguration;
+class G4MoleculeDefinition;
+
+namespace MI {
+
+//==============================================================================
+// Ionised water configurations, e.g. "DoubleIonisation14" = one hole in
+// each of the 4th and 5th shells. All of them are listed in a compile-time
+// table and registered by one routine. Registered configurations are found
+// in O(1) from their shell pattern (number of holes per shell, 0-2), whose
+// base-3 code is the index of a dense table (3^5 entries).
+//==============================================================================
+struct DNAIonisationConfiguration {
+  static constexpr int kNShells = 5;
+
+  std::uint8_t order;  // number of removed electrons, 1-4
+  std::uint8_t number; // suffix of the configuration name
+  std::array<std::uint8_t, kNShells> holes;
+
+  // e.g. "TripleIonisation30"
+  G4String GetName() const;
+
+  constexpr int GetCode() const
+  {
+    int code = 0;
+    for (int s = kNShells - 1; s >= 0; s--) { code = 3 * code + holes[s]; }
+    return code;
+  }
+};
+
+//==============================================================================
+class DNAIonisationConfigurationTable {
+public:
+  static constexpr int kNShells = DNAIonisationConfiguration::kNShells;
+  static constexpr int kNPatterns = 243; // 3^kNShells
+  static constexpr int kMaxOrder = 4;
+
+  // all the configurations in the order of registration
+  static const DNAIonisationConfiguration* begin();
+  static const DNAIonisationConfiguration* end();
+  static std::size_t size();
+
+  // register the configurations of the given ionisation order with copies
+  // of the decay channels (the prototypes are deleted)
+  static void Register(
+    G4MoleculeDefinition* water, int order,
+    std::initializer_list<G4MolecularDissociationChannel*> channels);
+
+  // nullptr if the pattern is not a registered ionisation
+  static const G4MolecularConfiguration* Find(int order, int code);
+  static const G4MolecularConfiguration* Find(const G4ElectronOccupancy& occ);
+
+private:
+  static std::array<const G4MolecularConfiguration*, kNPatterns> index_;
+};
+
+//------------------------------------------------------------------------------
+inline const G4MolecularConfiguration*
+DNAIonisationConfigurationTable::Find(int order, int code)
+{
+  if (order < 1 || order > kMaxOrder || code < 0 || code >= kNPatterns) {
+    return nullptr;
+  }
+  // the order is implied by the pattern, it is only checked here
+  auto* conf = index_[code];
+  int sum = 0;
+  for (int c = code; c > 0; c /= 3) { sum += c % 3; }
+  return sum == order ? conf : nullptr;
+}
+
+} // end of namespace MI
+
+#endif // DNA_IONISATION_CONFIGURATION_H_
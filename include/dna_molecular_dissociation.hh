@@ -0,0 +1,101 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef DNA_MOLECULAR_DISSOCIATION_H_
+#define DNA_MOLECULAR_DISSOCIATION_H_
+
+#include "G4DNAMolecularDissociation.hh"
+
+#include <vector>
+
+class G4MolecularConfiguration;
+class G4MolecularDissociationChannel;
+
+namespace MI {
+
+//==============================================================================
+// Decay channel tables of the water configurations, indexed by the molecule
+// ID of each configuration. The channels of a configuration are stored in an
+// alias table (Walker / Vose), so that sampling a channel is one uniform
+// number and one array access, with neither string nor map lookups.
+// The channel probabilities are read as Geant4 does: the remainder of a sum
+// below one goes to the last channel, the channels beyond one are dropped.
+//
+// NOTE(SO): built at the first use, when the dissociation channels exist,
+// and read-only after; shared by all threads
+//==============================================================================
+class DNADissociationDispatch {
+public:
+  using Channel = const G4MolecularDissociationChannel;
+
+  static const DNADissociationDispatch* Instance();
+
+  // u uniform in [0, 1), nullptr if the configuration has no channel
+  Channel* Sample(const G4MolecularConfiguration* conf, double u) const;
+
+private:
+  DNADissociationDispatch();
+  ~DNADissociationDispatch() = default;
+
+  struct AliasTable {
+    std::vector<Channel*> channels;
+    std::vector<double> prob;
+    std::vector<int> alias;
+  };
+
+  static void BuildAliasTable(const std::vector<double>& weights,
+                              AliasTable& table);
+
+  std::vector<AliasTable> tables_;  // indexed by molecule ID
+};
+
+//==============================================================================
+// Water decay process sampling the channel from DNADissociationDispatch
+// instead of the linear search of G4DNAMolecularDissociation::DecayIt. The
+// products are built and displaced as in Geant4.
+//
+// NOTE(SO): opt-in (/physlist/decay_dispatch), it replaces
+// H2O_DNAMolecularDecay. The random sequence differs from Geant4: the same
+// uniform number selects another channel.
+//==============================================================================
+class DNAMolecularDissociation : public G4DNAMolecularDissociation {
+public:
+  explicit DNAMolecularDissociation(const G4String& name);
+  ~DNAMolecularDissociation() override = default;
+
+  G4VParticleChange* AtRestDoIt(const G4Track& track,
+                                const G4Step& step) override;
+  G4VParticleChange* PostStepDoIt(const G4Track& track,
+                                  const G4Step& step) override;
+
+private:
+  G4VParticleChange* Dissociate(const G4Track& track, const G4Step& step);
+};
+
+} // end of namespace MI
+
+#endif // DNA_MOLECULAR_DISSOCIATION_H_
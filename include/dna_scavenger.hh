@@ -0,0 +1,121 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef DNA_SCAVENGER_H_
+#define DNA_SCAVENGER_H_
+
+#include "G4Version.hh"
+#include "globals.hh"
+
+#include <vector>
+
+#if G4VERSION_NUMBER >= 1120
+#include "G4VChemistryWorld.hh"
+#endif
+
+class G4DNAMolecularReactionTable;
+class G4MolecularConfiguration;
+
+namespace MI {
+
+//==============================================================================
+// Scavengers dissolved in the water (e.g. O2) are not tracked as molecules.
+// Each one is registered as a pseudo-first-order reaction (reaction type 6)
+//   reactant + scavenger -> products,   rate = k [scavenger] [reactant]
+// which the IRT samples against the bulk concentration of the scavenger.
+// Products are regular molecules and are counted by the species scorer.
+//==============================================================================
+struct DNAScavenger {
+  G4String reactant;
+  G4String scavenger;
+  double rate_constant;  // [1/M/s]
+  double concentration;  // [M]
+  std::vector<G4String> products;
+};
+
+//==============================================================================
+// NOTE(SO): filled by /physlist/scavenger in PreInit on the master thread,
+// read-only afterwards
+class DNAScavengerTable {
+public:
+  static DNAScavengerTable* Instance();
+
+  void Add(const DNAScavenger& scavenger);
+
+  bool IsEmpty() const;
+
+  const std::vector<DNAScavenger>& GetScavengers() const;
+
+  // concentration [M] of a scavenger, 0 if not registered
+  double GetConcentration(const G4MolecularConfiguration* scavenger) const;
+
+  // called from the chemistry constructors
+  void ConstructReactions(G4DNAMolecularReactionTable* table) const;
+
+  // add back the scavenger reactions removed from the reaction table, which
+  // is shared by all threads: master only, before the workers start the run
+  void RestoreReactions() const;
+
+  // give the scavenger concentrations to the scheduler of this thread
+  void InstallScavengerMaterial() const;
+
+private:
+  DNAScavengerTable() = default;
+  ~DNAScavengerTable() = default;
+
+  std::vector<DNAScavenger> scavengers_;
+};
+
+//------------------------------------------------------------------------------
+inline bool DNAScavengerTable::IsEmpty() const
+{
+  return scavengers_.empty();
+}
+
+//------------------------------------------------------------------------------
+inline const std::vector<DNAScavenger>& DNAScavengerTable::GetScavengers() const
+{
+  return scavengers_;
+}
+
+#if G4VERSION_NUMBER >= 1120
+//==============================================================================
+// Chemistry world holding the bulk scavenger concentrations, bounded by
+// the world volume
+class DNAChemistryWorld : public G4VChemistryWorld {
+public:
+  DNAChemistryWorld() = default;
+  ~DNAChemistryWorld() override = default;
+
+  void ConstructChemistryBoundary() override;
+  void ConstructChemistryComponents() override;
+};
+#endif
+
+} // end of namespace MI
+
+#endif // DNA_SCAVENGER_H_
@@ -0,0 +1,106 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef DNA_SOLVATION_TABLE_H_
+#define DNA_SOLVATION_TABLE_H_
+
+#include "G4DNAOneStepThermalizationModel.hh"
+#include "G4ThreeVector.hh"
+#include "globals.hh"
+
+#include <ostream>
+#include <vector>
+
+namespace MI {
+
+//==============================================================================
+// Inverse-CDF tables of the thermalisation distance of the sub-excitation
+// electrons, for the model selected with /process/dna/e-SolvationSubType
+// (Meesungnoen2002, Ritchie1994 or Terrisol1990).
+// The distance quantiles are tabulated on a logarithmic energy grid from
+// samples of the Geant4 model (private random engine), and the direction is
+// isotropic. Sampling is one energy bin choice, one quantile interpolation
+// and a random direction.
+//
+// NOTE(SO): built once and read-only after, shared by all threads
+//==============================================================================
+class DNASolvationTable {
+public:
+  static DNASolvationTable* Instance();
+
+  // tabulate the model selected in G4EmParameters
+  void Build();
+
+  bool IsBuilt() const { return !quantiles_.empty(); }
+
+  void GetPenetration(G4double energy, G4ThreeVector& displacement) const;
+
+  G4double GetRmean(G4double energy) const;
+
+  // compare the mean, RMS and Kolmogorov distance of the tabulated
+  // distances with the Geant4 model
+  void Validate(std::ostream& os, G4int nsamples = 100000) const;
+
+  static constexpr G4int kNEnergies = 64;
+  static constexpr G4int kNQuantiles = 256;
+  static constexpr G4int kNCalibrations = 20000;
+
+private:
+  DNASolvationTable() = default;
+  ~DNASolvationTable() = default;
+
+  G4double GetEnergy(G4int index) const;
+  G4double SampleDistance(G4double energy) const;
+  void SampleModel(G4double energy, G4ThreeVector& displacement) const;
+
+  G4int model_{0};
+  G4String model_name_{""};
+  G4double log_emin_{0.};
+  G4double dlog_e_{0.};
+  std::vector<G4double> quantiles_;  // [energy][quantile]
+  std::vector<G4double> rmean_;      // [energy]
+};
+
+//------------------------------------------------------------------------------
+// penetration "model" of G4TDNAOneStepThermalizationModel
+struct TabulatedPenetration {
+  static void GetPenetration(G4double energy, G4ThreeVector& displacement)
+  {
+    DNASolvationTable::Instance()->GetPenetration(energy, displacement);
+  }
+  static double GetRmean(double energy)
+  {
+    return DNASolvationTable::Instance()->GetRmean(energy);
+  }
+};
+
+using DNATabulatedThermalizationModel =
+  G4TDNAOneStepThermalizationModel<TabulatedPenetration>;
+
+} // end of namespace MI
+
+#endif // DNA_SOLVATION_TABLE_H_
@@ -0,0 +1,129 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef HOMOGENEOUS_KINETICS_H_
+#define HOMOGENEOUS_KINETICS_H_
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+class G4MolecularConfiguration;
+
+namespace MI {
+
+//==============================================================================
+// Deterministic homogeneous kinetics used to continue the chemical stage
+// beyond the IRT hand-off time. The reaction network is taken from the
+// G4DNAMolecularReactionTable (i.e. from /chem/reaction/add) and integrated
+// with an adaptive second-order Rosenbrock scheme (ROS2), which is stable for
+// the stiff acid-base reactions of the water radiolysis network.
+//
+// Concentrations are given in mol/L and times in Geant4 units.
+//==============================================================================
+class HomogeneousKinetics {
+public:
+  using Species = const G4MolecularConfiguration;
+
+  HomogeneousKinetics() = default;
+  ~HomogeneousKinetics() = default;
+
+  // build the reaction network from the registered reaction table
+  void Initialize();
+
+  bool IsInitialized() const;
+
+  // index of a species in the network, -1 if it takes part in no reaction
+  int GetIndex(Species* species) const;
+
+  std::size_t GetNumberOfSpecies() const;
+
+  Species* GetSpecies(std::size_t index) const;
+
+  // integrate the concentrations from t0 to each of the (sorted) times,
+  // result[i] holds the concentrations at times[i]
+  void Solve(const std::vector<double>& conc0, double t0,
+             const std::vector<double>& times,
+             std::vector<std::vector<double>>& result) const;
+
+  void SetTolerances(double rtol, double atol);
+
+private:
+  struct Reaction {
+    int reactant1;
+    int reactant2;  // -1 for first-order reactions
+    std::vector<int> products;
+    double k;  // [1/M/s] or [1/s]
+  };
+
+  int AddSpecies(Species* species);
+
+  void ComputeDerivatives(const std::vector<double>& c,
+                          std::vector<double>& dcdt) const;
+
+  void ComputeJacobian(const std::vector<double>& c,
+                       std::vector<double>& jac) const;
+
+  bool Step(std::vector<double>& c, double h, double& err) const;
+
+  bool initialized_{false};
+  double rtol_{1.e-4};
+  double atol_{1.e-15};
+  std::vector<Species*> species_;
+  std::map<Species*, int> index_;
+  std::vector<Reaction> reactions_;
+};
+
+//------------------------------------------------------------------------------
+inline bool HomogeneousKinetics::IsInitialized() const
+{
+  return initialized_;
+}
+
+//------------------------------------------------------------------------------
+inline std::size_t HomogeneousKinetics::GetNumberOfSpecies() const
+{
+  return species_.size();
+}
+
+//------------------------------------------------------------------------------
+inline HomogeneousKinetics::Species*
+HomogeneousKinetics::GetSpecies(std::size_t index) const
+{
+  return species_[index];
+}
+
+//------------------------------------------------------------------------------
+inline void HomogeneousKinetics::SetTolerances(double rtol, double atol)
+{
+  rtol_ = rtol;
+  atol_ = atol;
+}
+
+} // end of namespace MI
+
+#endif // HOMOGENEOUS_KINETICS_H_
@@ -0,0 +1,83 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef LATENCY_HISTOGRAM_H_
+#define LATENCY_HISTOGRAM_H_
+
+#include <array>
+#include <cmath>
+
+namespace MI {
+
+//==============================================================================
+// Log-scale histogram of durations (1 us to 10^4 s, 20 bins per decade)
+// with quantile estimation, cheap to fill per event and to merge.
+// The values outside the range are put in the edge bins, the maximum is
+// kept exactly.
+//==============================================================================
+class LatencyHistogram {
+public:
+  static constexpr int kNDecades = 10;
+  static constexpr int kBinsPerDecade = 20;
+  static constexpr int kNBins = kNDecades * kBinsPerDecade;
+  static constexpr double kMin = 1.e-6;  // (s)
+
+  void Fill(double seconds);
+
+  void Merge(const LatencyHistogram& other);
+
+  long GetEntries() const { return entries_; }
+  double GetMax() const { return max_; }
+  double GetMean() const { return entries_ > 0 ? sum_ / entries_ : 0.; }
+
+  // q in [0, 1], log-linear interpolation within the bin
+  double GetQuantile(double q) const;
+
+private:
+  std::array<long, kNBins> bins_{};
+  long entries_{0};
+  double sum_{0.};
+  double max_{0.};
+};
+
+//------------------------------------------------------------------------------
+inline void LatencyHistogram::Fill(double seconds)
+{
+  int bin = 0;
+  if (seconds > kMin) {
+    bin = static_cast<int>(std::log10(seconds / kMin) * kBinsPerDecade);
+    if (bin >= kNBins) { bin = kNBins - 1; }
+  }
+  bins_[bin]++;
+  entries_++;
+  sum_ += seconds;
+  if (seconds > max_) { max_ = seconds; }
+}
+
+} // end of namespace MI
+
+#endif // LATENCY_HISTOGRAM_H_
@@ -0,0 +1,121 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef MEMORY_TRACKER_H_
+#define MEMORY_TRACKER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace MI {
+
+//==============================================================================
+// Heap usage per thread, counted by the replacement of the global operator
+// new / delete (glibc and macOS, built with -DCHEM6_MEMORY_TRACKER=ON, see
+// IsAvailable), the peak number of live chemical species per event, and an
+// optional soft cap on the live heap (only with the heap counters): a thread
+// waits before starting an event while the live heap is above the cap and
+// other threads are still processing an event.
+//
+// NOTE(SO): memory is attributed to the thread which allocates it and is
+// released from the thread which frees it, so that the live memory of a
+// thread is approximate when the objects are passed between the threads
+// (the sum over the threads is exact).
+//==============================================================================
+class MemoryTracker {
+public:
+  struct ThreadStats {
+    int thread_id;       // G4 thread ID, -1 for the master / unregistered
+    double allocated;    // allocated since the beginning of the run (MB)
+    long allocations;    // since the beginning of the run
+    double live;         // MB
+    double peak;         // high-water mark of the live memory (MB)
+  };
+
+  static MemoryTracker* Instance();
+
+  // allocations are counted (replacement of operator new)
+  static bool IsAvailable();
+
+  // associate the G4 thread ID with the counters of the calling thread
+  void RegisterThread();
+
+  // start of a run: the totals and peaks are counted from now
+  void ResetRun();
+
+  std::vector<ThreadStats> GetThreadStats() const;
+
+  // live heap of all the threads (MB)
+  double GetLiveMemory() const;
+
+  // live chemical species in the event of the calling thread
+  void SetLiveSpecies(long n);
+
+  // live chemical species in the events in flight of all the threads
+  long GetLiveSpecies() const;
+
+  // peak number of live species of the last event of the calling thread
+  long TakeEventPeakSpecies();
+
+  // soft cap of the live heap (MB), 0 for none; ignored with a warning when
+  // the allocations are not counted
+  void SetSoftCap(double mb);
+  double GetSoftCap() const { return soft_cap_.load(std::memory_order_relaxed); }
+
+  // called at the beginning / end of each event
+  void BeginEvent();
+  void EndEvent();
+
+  // write Memory<runID>.csv at the end of each run
+  void EnableCSV(bool in) { csv_.store(in, std::memory_order_relaxed); }
+  bool IsCSVEnabled() const { return csv_.load(std::memory_order_relaxed); }
+
+  long GetNWaits() const { return nwaits_.load(); }
+  double GetWaitTime() const { return wait_time_.load(); }
+
+private:
+  MemoryTracker() = default;
+  ~MemoryTracker() = default;
+
+  std::atomic<double> soft_cap_{0.};
+  std::atomic<bool> csv_{false};
+  std::atomic<int> busy_{0};  // threads processing an event
+  std::atomic<long> nwaits_{0};
+  std::atomic<double> wait_time_{0.};  // s, written under gate_mutex_
+
+  // threads waiting for the cap, and ended events which may admit them
+  std::mutex gate_mutex_;
+  std::condition_variable gate_;
+  int waiting_{0};
+  long releases_{0};
+};
+
+} // end of namespace MI
+
+#endif // MEMORY_TRACKER_H_
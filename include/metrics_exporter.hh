@@ -0,0 +1,127 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef METRICS_EXPORTER_H_
+#define METRICS_EXPORTER_H_
+
+#include "globals.hh"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MI {
+
+//==============================================================================
+// Live progress of the runs (/perf/metrics/file), written periodically by a
+// background thread in the Prometheus text format, e.g. for the textfile
+// collector of node_exporter: events processed, events/min., busy fraction
+// of each thread, aborted events, live chemical species, sweep point and
+// estimated time remaining of the run.
+// The file is written to a temporary file and renamed, so that a reader
+// never sees a partial file.
+//
+// NOTE(SO): the events are aborted by PrimaryKiller only in this
+// application, the aborted events are counted at the end of the events
+//==============================================================================
+class MetricsExporter {
+public:
+  static MetricsExporter* Instance();
+
+  // start / stop the writer thread ("" to stop)
+  void Enable(const G4String& file);
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  void SetInterval(double seconds);
+
+  // point of a parameter sweep, e.g. a physics:chemistry combination
+  void SetSweepPoint(const G4String& label, int index = -1, int npoints = 0);
+
+  // master, at the beginning / end of a run
+  void BeginRun(int run_id, long nevents);
+  void EndRun();
+
+  // calling thread, at the beginning / end of each event
+  void BeginEvent();
+  void EndEvent(bool aborted);
+
+  // write the last values and join the writer thread
+  void Stop();
+
+private:
+  MetricsExporter();
+  ~MetricsExporter();
+
+  // written by its thread, read by the writer thread
+  struct Slot {
+    G4int thread;
+    std::atomic<long> events{0};
+    std::atomic<double> busy{0.};         // s in events during the run
+    std::atomic<double> event_start{-1.}; // s, negative when idle
+  };
+
+  double Now() const;
+  Slot* GetSlot();
+  void Loop();
+  void Write();
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<double> interval_{10.};  // s
+  std::string file_;
+
+  std::chrono::steady_clock::time_point origin_;
+  std::atomic<int> run_id_{-1};
+  std::atomic<long> nevents_{0};
+  std::atomic<bool> in_run_{false};
+  std::atomic<double> run_start_{0.};
+  std::atomic<double> run_end_{0.};
+  std::atomic<long> aborted_{0};
+  std::atomic<long> events_total_{0};  // over the runs
+
+  std::string sweep_label_;
+  int sweep_index_{-1};
+  int sweep_npoints_{0};
+
+  // events/min. between two writes
+  long last_events_{0};
+  double last_time_{0.};
+
+  std::mutex mutex_;  // registration of the slots, file and sweep point
+  std::vector<std::unique_ptr<Slot>> slots_;
+  std::condition_variable wakeup_;
+  bool stop_{false};
+  std::thread writer_;
+};
+
+} // end of namespace MI
+
+#endif // METRICS_EXPORTER_H_
@@ -0,0 +1,77 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef PERF_COUNTERS_H_
+#define PERF_COUNTERS_H_
+
+#include <array>
+#include <atomic>
+
+namespace MI {
+
+//==============================================================================
+// Hardware counters (cycles, instructions, cache and branch misses) of the
+// calling thread, read with Linux perf_event_open as one group per thread.
+// TimeHistory reads them at the stage boundaries when enabled
+// (/perf/counters/enable) and reports the totals per stage.
+// When a counter cannot be opened (other OS, perf_event_paranoid, virtual
+// machine) its value is negative and it is reported as not available.
+//==============================================================================
+class PerfCounters {
+public:
+  enum Counter {
+    kCycles = 0,
+    kInstructions,
+    kCacheMisses,
+    kBranchMisses,
+    kNCounters
+  };
+
+  using Values = std::array<double, kNCounters>;
+
+  static PerfCounters* Instance();
+
+  void Enable(bool in) { enabled_.store(in, std::memory_order_relaxed); }
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // counters of the calling thread, opened at the first call;
+  // false (and negative values) if none is available
+  bool Read(Values& values);
+
+  static const char* GetCounterName(Counter counter);
+
+private:
+  PerfCounters() = default;
+  ~PerfCounters() = default;
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<bool> warned_{false};
+};
+
+} // end of namespace MI
+
+#endif // PERF_COUNTERS_H_
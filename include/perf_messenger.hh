@@ -0,0 +1,74 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef PERF_MESSENGER_H_
+#define PERF_MESSENGER_H_
+
+#include "G4UImessenger.hh"
+
+class G4UIcmdWithABool;
+class G4UIcmdWithADouble;
+class G4UIcmdWithAString;
+class G4UIcmdWithAnInteger;
+class G4UIdirectory;
+
+namespace MI {
+
+//==============================================================================
+// /perf/ commands: performance instrumentation of the application
+//
+// NOTE(SO): the instrumentation is shared by all threads, the commands are
+// not broadcast to the workers
+//==============================================================================
+class PerfMessenger : public G4UImessenger {
+public:
+  PerfMessenger();
+  ~PerfMessenger() override;
+
+  void SetNewValue(G4UIcommand* cmd, G4String val) override;
+
+private:
+  G4UIdirectory* perf_dir_{nullptr};
+  G4UIdirectory* trace_dir_{nullptr};
+  G4UIcmdWithAString* trace_file_cmd_{nullptr};
+  G4UIcmdWithAnInteger* trace_size_cmd_{nullptr};
+  G4UIdirectory* counters_dir_{nullptr};
+  G4UIcmdWithABool* counters_enable_cmd_{nullptr};
+  G4UIdirectory* memory_dir_{nullptr};
+  G4UIcmdWithADouble* memory_cap_cmd_{nullptr};
+  G4UIcmdWithABool* memory_csv_cmd_{nullptr};
+  G4UIdirectory* reactions_dir_{nullptr};
+  G4UIcmdWithABool* reactions_enable_cmd_{nullptr};
+  G4UIdirectory* metrics_dir_{nullptr};
+  G4UIcmdWithAString* metrics_file_cmd_{nullptr};
+  G4UIcmdWithADouble* metrics_interval_cmd_{nullptr};
+  G4UIcmdWithAString* metrics_sweep_cmd_{nullptr};
+};
+
+} // end of namespace MI
+
+#endif // PERF_MESSENGER_H_
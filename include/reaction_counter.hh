@@ -0,0 +1,91 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef REACTION_COUNTER_H_
+#define REACTION_COUNTER_H_
+
+#include "globals.hh"
+
+#include <ostream>
+#include <vector>
+
+class G4MolecularConfiguration;
+
+namespace MI {
+
+//==============================================================================
+// Number of reactions per reaction channel and per time decade.
+// Counts are accumulated in a flat thread-local array, moved into the
+// Run at the end of each event and merged into the master run.
+// Layout: counts[channel * kNDecades + decade], the channels are the
+// reactions of the ChemistrySnapshot and the last one collects reactions
+// not found in it (e.g. scavenging).
+//
+// NOTE(SO): one instance per thread, the channel index is shared
+//==============================================================================
+class ReactionCounter {
+public:
+  using Species = const G4MolecularConfiguration;
+
+  // decade 0 : t < 1 ps, decade i : 10^(i-1) ps <= t < 10^i ps,
+  // the last decade is open-ended (t >= 1 s)
+  static constexpr int kNDecades = 14;
+
+  static ReactionCounter* Instance();
+
+  // counting is opt-in (/perf/reactions/enable), shared by all threads
+  static void Enable(bool in);
+  static bool IsEnabled();
+
+  // size the counts on the chemistry snapshot of the run, none if disabled
+  void Initialize(G4int run_id);
+
+  // reactant2 is nullptr for pseudo-first-order reactions
+  void Count(Species* reactant1, Species* reactant2, double time);
+
+  std::size_t GetNumberOfChannels() const;
+
+  G4String GetChannelName(std::size_t channel) const;
+
+  // add the counts of this thread to the given array and reset them
+  void Absorb(std::vector<G4long>& counts);
+
+  void Print(const std::vector<G4long>& counts, std::ostream& os,
+             std::size_t nmax = 0) const;
+
+private:
+  ReactionCounter() = default;
+  ~ReactionCounter() = default;
+
+  static int GetDecade(double time);
+
+  std::vector<G4long> counts_;
+};
+
+} // end of namespace MI
+
+#endif // REACTION_COUNTER_H_
@@ -0,0 +1,127 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef REACTION_LOG_H_
+#define REACTION_LOG_H_
+
+#include "globals.hh"
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <set>
+#include <vector>
+
+class G4MolecularConfiguration;
+
+namespace MI {
+
+//==============================================================================
+// Per-event log of the creation (+1) and destruction (-1) of chemical
+// species. The number of species at any time is rebuilt by a prefix-sum
+// scan over the time-ordered log, so the time grid of the scorer does not
+// require to query the molecule counter, and the log written to a binary
+// file lets the grid be changed after the run (see rebuildG_time.C).
+//
+// File layout (little endian), one file per thread:
+//   header  : char[8] "MILOG001"
+//   chunk   : uint32 type, uint32 size (bytes of the payload), payload
+//   type 1  : species, uint32 n, n x { uint16 index, uint16 len, char[len] }
+//   type 2  : event, int32 event ID, double edep [eV], uint32 n,
+//             n x { double time [ns], uint16 index, int16 delta }
+//   type 3  : run, int32 run ID, before the first event of each run
+//   type 4  : solvent, uint32 n, n x uint16 index, the species of the water
+//             molecule (ignored by the molecule counter and the scorer)
+//
+// A species is created when the scheduler starts tracking it and destroyed
+// when it is killed (ITTrackingInteractivity): the water molecules of the
+// pre-chemical stage are destroyed by their dissociation, which creates the
+// radiolysis products. A negative number of species is a fatal error.
+//
+// NOTE(SO): one instance per thread
+//==============================================================================
+class ReactionLog {
+public:
+  using Species = const G4MolecularConfiguration;
+
+  static ReactionLog* Instance();
+
+  // enable the log, the file name is <prefix>[_t<thread ID>].bin,
+  // nothing is written with an empty prefix
+  void Enable(const G4String& prefix);
+
+  bool IsEnabled() const;
+
+  // start a new event
+  void Clear();
+
+  void Record(Species* species, double time, int delta);
+
+  // numbers of species at each of the times (all the species of the event,
+  // the solvent included)
+  void CountAtTimes(const std::set<double>& times,
+                    std::map<double, std::map<Species*, double>>& counts);
+
+  // append the current event to the file
+  void Write(int run_id, int event_id, double edep);
+
+private:
+  ReactionLog() = default;
+  ~ReactionLog();
+
+  struct Entry {
+    double time;
+    std::uint16_t index;
+    std::int16_t delta;
+  };
+
+  std::uint16_t GetIndex(Species* species);
+
+  void SortEntries();
+
+  bool enabled_{false};
+  bool sorted_{true};
+  G4String file_name_;
+  std::ofstream file_;
+  std::vector<Entry> entries_;
+  std::vector<Species*> species_;
+  std::map<Species*, std::uint16_t> index_;
+  std::vector<std::uint16_t> solvent_;  // indices of the water species
+  std::size_t nwritten_species_{0};
+  std::size_t nwritten_solvent_{0};
+  int written_run_{-1};
+};
+
+//------------------------------------------------------------------------------
+inline bool ReactionLog::IsEnabled() const
+{
+  return enabled_;
+}
+
+} // end of namespace MI
+
+#endif // REACTION_LOG_H_
@@ -0,0 +1,102 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef SPECIES_FILTER_H_
+#define SPECIES_FILTER_H_
+
+#include "globals.hh"
+
+#include <set>
+
+class G4MolecularConfiguration;
+class G4MoleculeDefinition;
+
+namespace MI {
+
+//==============================================================================
+// Set of scored species (/scorer/species/score). Species that are not scored
+// and cannot react with anything in the reaction table ("inert") are dropped
+// as soon as they are created: they are not counted and their tracks are
+// killed when they appear as reaction products.
+// An empty set means that all species are scored and nothing is dropped.
+//
+// NOTE(SO): one instance per thread, rebuilt at the beginning of each run
+// because the reaction table is only complete after /run/initialize. The
+// molecule counter cannot count an ignored molecule again: a species dropped
+// in a run must stay dropped in the later runs (fatal error otherwise).
+//==============================================================================
+class SpeciesFilter {
+public:
+  using Species = const G4MolecularConfiguration;
+
+  static SpeciesFilter* Instance();
+
+  // name of a molecular configuration, as in /chem/reaction/add
+  void AddScoredSpecies(const G4String& name);
+
+  bool HasScoredSpecies() const;
+
+  // build the scored and inert sets of the run, and ignore the inert
+  // molecules in the molecule counter
+  void Update(G4int run_id);
+
+  bool IsScored(Species* species) const;
+
+  // not scored and not able to react
+  bool IsDropped(Species* species) const;
+
+private:
+  SpeciesFilter() = default;
+  ~SpeciesFilter() = default;
+
+  std::set<G4String> scored_names_;
+  std::set<Species*> scored_;
+  std::set<Species*> dropped_;
+  std::set<const G4MoleculeDefinition*> ignored_;  // by the molecule counter
+};
+
+//------------------------------------------------------------------------------
+inline bool SpeciesFilter::HasScoredSpecies() const
+{
+  return !scored_names_.empty();
+}
+
+//------------------------------------------------------------------------------
+inline bool SpeciesFilter::IsScored(Species* species) const
+{
+  return scored_names_.empty() || scored_.count(species) > 0;
+}
+
+//------------------------------------------------------------------------------
+inline bool SpeciesFilter::IsDropped(Species* species) const
+{
+  return dropped_.count(species) > 0;
+}
+
+} // end of namespace MI
+
+#endif // SPECIES_FILTER_H_
@@ -0,0 +1,100 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef SPECIES_SET_H_
+#define SPECIES_SET_H_
+
+#include "globals.hh"
+#include "G4ThreeVector.hh"
+
+#include <fstream>
+#include <vector>
+
+class G4Track;
+
+namespace MI {
+
+//==============================================================================
+// Chemical species at the beginning of the chemical stage of an event,
+// recorded by chem6 after the first time step of the scheduler, once the
+// water molecules have dissociated (/scorer/species/speciesSet), or built
+// synthetically, and injected by chem6_chembench, which runs the chemical
+// stage only.
+//
+// Text file, one line per species (lines starting with # are comments):
+//   <event ID> <species user ID> <x> <y> <z> [nm] <time> [ps]
+//==============================================================================
+struct SpeciesEntry {
+  G4String species;  // user ID of the molecule table, e.g. e_aq, °OH
+  G4ThreeVector position;
+  G4double time;
+};
+
+using SpeciesSet = std::vector<SpeciesEntry>;
+
+// the species sets of a file in the order of the events
+std::vector<SpeciesSet> ReadSpeciesSets(const G4String& file_name);
+
+// approximate yields at 1 ps of water radiolysis, n species in a cube
+SpeciesSet MakeUniformSpeciesSet(G4int n, G4double size);
+
+// species of the approximate yields at 1 ps along a track core on the z
+// axis, with a Gaussian radial profile
+SpeciesSet MakeTrackSpeciesSet(G4double let, G4double length, G4double radius);
+
+//==============================================================================
+// Writer of the species sets of chem6 events
+//
+// NOTE(SO): one instance per thread
+//==============================================================================
+class SpeciesSetWriter {
+public:
+  static SpeciesSetWriter* Instance();
+
+  // enable the writer, the file name is <prefix>[_t<thread ID>].txt
+  void Enable(const G4String& prefix);
+
+  bool IsEnabled() const { return enabled_; }
+
+  void Add(const G4Track* track);
+
+  // append the species of the current event to the file
+  void Write(G4int event_id);
+
+private:
+  SpeciesSetWriter() = default;
+  ~SpeciesSetWriter();
+
+  bool enabled_{false};
+  G4String file_name_;
+  std::ofstream file_;
+  SpeciesSet entries_;
+};
+
+} // end of namespace MI
+
+#endif // SPECIES_SET_H_
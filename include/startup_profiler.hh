@@ -0,0 +1,101 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef STARTUP_PROFILER_H_
+#define STARTUP_PROFILER_H_
+
+#include "globals.hh"
+
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace MI {
+
+//==============================================================================
+// Wall time and peak resident memory of the startup phases (geometry,
+// physics list, physics tables, chemistry, worker spin-up) per thread.
+// The breakdown is printed and written to Startup.csv once the first run
+// of all threads has started.
+//
+// NOTE(SO): one instance shared by all threads, the time origin is its
+// creation at the start of main() (or the last Reset())
+//==============================================================================
+class StartupProfiler {
+public:
+  static StartupProfiler* Instance();
+
+  void Begin(const G4String& phase);
+  void End(const G4String& phase);
+
+  // time the physics tables of the calling thread: the phase is opened when
+  // the first run initialisation starts (Idle -> Init) and closed when it
+  // ends (Init -> Idle), macro commands and idle time are not counted
+  void WatchPhysicsTables();
+
+  // new time origin, the recorded phases are dropped (forked processes)
+  void Reset();
+
+  // print the table and write the CSV file (only the first call)
+  void Report(std::ostream& os, const G4String& file = "Startup.csv");
+
+  // Begin / End of a phase in a scope
+  class Scope {
+  public:
+    explicit Scope(const G4String& phase) : phase_{phase}
+    {
+      StartupProfiler::Instance()->Begin(phase_);
+    }
+    ~Scope() { StartupProfiler::Instance()->End(phase_); }
+  private:
+    G4String phase_;
+  };
+
+private:
+  StartupProfiler();
+  ~StartupProfiler() = default;
+
+  double GetTime() const;
+
+  struct Phase {
+    G4String name;
+    G4int thread;
+    double start;
+    double end;
+    double peak_rss;
+  };
+
+  std::chrono::steady_clock::time_point t0_;
+  std::mutex mutex_;
+  std::vector<Phase> phases_;
+  bool reported_{false};
+};
+
+} // end of namespace MI
+
+#endif // STARTUP_PROFILER_H_
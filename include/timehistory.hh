@@ -38,12 +38,45 @@ See the License for more information.
 #ifndef TIME_HISTORY_H_
 #define TIME_HISTORY_H_
 
+#include <array>
+#include <chrono>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
-#include "stopwatch.hh"
-
+#include <vector>
+#include "perf_counters.hh"
+
+// NOTE(SO): splits and stage timers are written to per-thread buffers;
+// the named splits are rare and locked per buffer, so that any thread can
+// look them up (e.g. "Start"), while the stage timers are written without
+// locking and only read when reported (the other threads must be idle
+// then, e.g. at the end of a run)
 class TimeHistory {
 public:
+  // nested stages of a run
+  enum Stage {
+    kRun = 0,
+    kEvent,
+    kPhysics,
+    kPreChemistry,
+    kChemistry,
+    kScoring,
+    kMerge,     // Run::Merge of a worker run (serialised)
+    kAbsorb,    // worker scorer absorbed by the master scorer
+    kNStages
+  };
+
+  using StageTimes = std::array<double, kNStages>;
+
+  struct StageRecord {
+    double total = 0.;  // inclusive time (s)
+    double self = 0.;   // exclusive of the nested stages (s)
+    long count = 0;
+    // inclusive hardware counters, negative if not counted
+    MI::PerfCounters::Values counters{{-1., -1., -1., -1.}};
+  };
+
   static TimeHistory* GetTimeHistory();
   virtual ~TimeHistory() = default;
 
@@ -64,12 +97,64 @@ public:
 
   void ShowClock(const std::string& prefix="") const;
 
+  // stage timers of the calling thread
+  void BeginStage(Stage stage);
+  void EndStage(Stage stage);
+
+  // Begin / End of a stage in a scope
+  class Scope {
+  public:
+    explicit Scope(Stage stage) : stage_(stage)
+    {
+      TimeHistory::GetTimeHistory()->BeginStage(stage_);
+    }
+    ~Scope() { TimeHistory::GetTimeHistory()->EndStage(stage_); }
+  private:
+    Stage stage_;
+  };
+
+  // stage records summed over all the threads
+  std::vector<StageRecord> GetStageRecords() const;
+
+  void ResetStages();
+
+  // wall and CPU time (s) of the stages ended by the calling thread since
+  // the previous call, e.g. per event
+  void TakeEventStages(StageTimes& wall, StageTimes& cpu);
+
+  static const char* GetStageName(Stage stage);
+
 private:
   TimeHistory();
 
-  Stopwatch sw_;
-  double t0_;
-  std::map<std::string, double> split_history_;
+  struct OpenStage {
+    Stage stage;
+    double start;
+    double cpu_start;
+    double children;
+    MI::PerfCounters::Values counters;
+  };
+
+  struct ThreadBuffer {
+    std::mutex split_mutex;  // split_history, written by the owner only
+    std::map<std::string, double> split_history;
+    std::vector<OpenStage> stack;
+    StageRecord stages[kNStages];
+    StageTimes event_wall{};
+    StageTimes event_cpu{};
+  };
+
+  double Now() const;
+
+  static double ThreadCPUTime();
+
+  static void ReadCounters(MI::PerfCounters::Values& values);
+
+  ThreadBuffer* GetThreadBuffer() const;
+
+  std::chrono::steady_clock::time_point t0_;
+  mutable std::mutex mutex_;  // registration of the buffers and reports
+  mutable std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
 
 };
 
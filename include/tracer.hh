@@ -0,0 +1,104 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#ifndef TRACER_H_
+#define TRACER_H_
+
+#include "globals.hh"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MI {
+
+//==============================================================================
+// Opt-in timeline of the runs, events, event stages, merges and outputs of
+// each thread (/perf/trace/file), written at exit as trace-event JSON
+// ("X" complete events) for chrome://tracing or Perfetto.
+// Each thread records into its own ring buffer without locking; when a
+// buffer is full the oldest records are overwritten.
+//
+// NOTE(SO): the names must be string literals (they are not copied) and the
+// times are those of TimeHistory (s since the start of the program)
+//==============================================================================
+class Tracer {
+public:
+  static Tracer* Instance();
+
+  void Enable(const G4String& file);
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // records per thread (24 bytes each), used when a thread records for the
+  // first time: a later change does not resize its buffer
+  void SetBufferSize(std::size_t size) { buffer_size_ = size; }
+
+  void Record(const char* name, double start, double end);
+
+  // write the JSON file, if enabled (all threads must have finished)
+  void Write();
+
+  // record of a scope
+  class Scope {
+  public:
+    explicit Scope(const char* name);
+    ~Scope();
+  private:
+    const char* name_;
+    double start_;
+  };
+
+private:
+  Tracer() = default;
+  ~Tracer() = default;
+
+  struct Entry {
+    const char* name;
+    double start;
+    double end;
+  };
+
+  struct Ring {
+    G4int thread;
+    std::vector<Entry> entries;
+    std::size_t next = 0;
+    std::size_t count = 0;
+  };
+
+  Ring* GetRing();
+
+  std::atomic<bool> enabled_{false};
+  G4String file_{""};
+  std::size_t buffer_size_{1 << 16};
+  std::mutex mutex_;  // registration of the rings
+  std::vector<std::unique_ptr<Ring>> rings_;
+};
+
+} // end of namespace MI
+
+#endif // TRACER_H_
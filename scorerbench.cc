@@ -0,0 +1,416 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+//
+// chem6_scorerbench: microbenchmark of the scorer hot paths
+//
+// The scorers of chem6 are fed with synthetic steps and species
+// populations in the first event of a one-thread run, so that the worker
+// scorers, the master scorers and the current event are those of chem6:
+//   ScoreSpecies::ProcessHits, ScoreLET::ProcessHits,
+//   PrimaryKiller::ProcessHits        synthetic electron steps
+//   ReactionLog::Record               creation / destruction of species
+//   ScoreSpecies::EndOfEvent          species counted from the reaction log
+//   ScoreSpecies::AbsorbResultsFromWorkerScorer, Run::Merge
+//                                     worker results of one event
+// The time per call (ns) is printed at the end.
+//
+// NOTE(SO): the species are counted on the reaction-log path
+// (/scorer/species/reactionLog), the rows are labelled so; the default
+// path of chem6 queries G4MoleculeCounter and is not timed here
+//
+// usage: chem6_scorerbench [-n calls] [-e events] [-b time bins] [-s species]
+//
+#include "DetectorConstruction.hh"
+#include "PhysicsList.hh"
+#include "PrimaryKiller.hh"
+#include "Run.hh"
+#include "ScoreSpecies.hh"
+#include "reaction_counter.hh"
+#include "reaction_log.hh"
+
+#include "G4DynamicParticle.hh"
+#include "G4Electron.hh"
+#include "G4Event.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4MoleculeTable.hh"
+#include "G4MultiFunctionalDetector.hh"
+#include "G4Navigator.hh"
+#include "G4ProcessManager.hh"
+#include "G4ProcessVector.hh"
+#include "G4RunManager.hh"
+#include "G4RunManagerFactory.hh"
+#include "G4SDManager.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4TouchableHistory.hh"
+#include "G4Track.hh"
+#include "G4TransportationManager.hh"
+#include "G4UImanager.hh"
+#include "G4UserEventAction.hh"
+#include "G4UserRunAction.hh"
+#include "G4VUserActionInitialization.hh"
+#include "G4VUserPrimaryGeneratorAction.hh"
+
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <vector>
+
+// NOTE(SO): referenced by the chem6 sources (RunAction, ScoreSpecies)
+std::ofstream out;
+long nProcessedEvents = 0;
+double processingTime = 0.;
+
+namespace {
+
+struct BenchOptions {
+  long ncalls = 1000000;  // calls of ProcessHits, Record
+  G4int nevents = 200;    // calls of EndOfEvent, Absorb, Merge
+  G4int nbins = 50;       // times to record, 1 ps - 1 us
+  G4int nspecies = 3000;  // species created per event
+};
+
+BenchOptions options;
+
+struct BenchResult {
+  const char* name;
+  long calls;
+  double seconds;
+};
+
+// written by the worker, printed by the master once the run is over
+std::vector<BenchResult> results;
+
+using Clock = std::chrono::steady_clock;
+
+//------------------------------------------------------------------------------
+double Elapsed(Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+//------------------------------------------------------------------------------
+G4VPrimitiveScorer* FindScorer(const G4String& name)
+{
+  auto* detector = dynamic_cast<G4MultiFunctionalDetector*>(
+    G4SDManager::GetSDMpointer()->FindSensitiveDetector("mfDetector"));
+  for (G4int i = 0; detector != nullptr && i < detector->GetNumberOfPrimitives(); i++) {
+    if (detector->GetPrimitive(i)->GetName() == name) return detector->GetPrimitive(i);
+  }
+  return nullptr;
+}
+
+//==============================================================================
+// synthetic steps of a primary electron in the world volume
+//==============================================================================
+class StepPool {
+public:
+  explicit StepPool(G4int n);
+
+  G4Step* operator[](std::size_t i) const { return steps_[i % steps_.size()].get(); }
+
+private:
+  G4Navigator navigator_;
+  std::vector<std::unique_ptr<G4Track>> tracks_;
+  std::vector<std::unique_ptr<G4Step>> steps_;
+};
+
+//------------------------------------------------------------------------------
+StepPool::StepPool(G4int n)
+{
+  navigator_.SetWorldVolume(G4TransportationManager::GetTransportationManager()
+                              ->GetNavigatorForTracking()->GetWorldVolume());
+  navigator_.LocateGlobalPointAndSetup(G4ThreeVector(), nullptr, false, true);
+  G4TouchableHandle touchable(navigator_.CreateTouchableHistory());
+
+  // an electromagnetic process of the electron, ScoreLET skips the steps
+  // defined by the processes of subtype 56 and 57
+  const G4VProcess* process = nullptr;
+  auto* processes = G4Electron::Definition()->GetProcessManager()->GetProcessList();
+  for (std::size_t i = 0; i < processes->size(); i++) {
+    auto* candidate = (*processes)[i];
+    auto subType = candidate->GetProcessSubType();
+    if (candidate->GetProcessType() == fElectromagnetic && subType != 56 && subType != 57) {
+      process = candidate;
+      break;
+    }
+  }
+  if (process == nullptr && processes->size() > 0) process = (*processes)[0];
+
+  std::mt19937 engine(12345);
+  std::uniform_real_distribution<double> edep(0., 100. * eV);
+  std::uniform_real_distribution<double> length(0.1 * nm, 10. * nm);
+
+  G4double energy = 1. * MeV;
+  G4ThreeVector position;
+  for (G4int i = 0; i < n; i++) {
+    auto* particle = new G4DynamicParticle(G4Electron::Definition(),
+                                           G4ThreeVector(0., 0., 1.), energy);
+    auto track = std::make_unique<G4Track>(particle, 0., position);
+    track->SetTrackID(1);
+
+    // one step in eight deposits nothing
+    const G4double deposit = i % 8 == 0 ? 0. : edep(engine);
+    const G4double step_length = length(engine);
+    auto step = std::make_unique<G4Step>();
+    step->SetTrack(track.get());
+    step->SetTotalEnergyDeposit(deposit);
+    step->SetStepLength(step_length);
+
+    auto* pre = step->GetPreStepPoint();
+    pre->SetPosition(position);
+    pre->SetKineticEnergy(energy);
+    pre->SetWeight(1.);
+    pre->SetTouchableHandle(touchable);
+
+    position += G4ThreeVector(0., 0., step_length);
+    auto* post = step->GetPostStepPoint();
+    post->SetPosition(position);
+    post->SetKineticEnergy(energy - deposit);
+    post->SetProcessDefinedStep(process);
+
+    tracks_.push_back(std::move(track));
+    steps_.push_back(std::move(step));
+  }
+}
+
+//==============================================================================
+// species population of an event: creations at 1 ps, half of the species
+// destroyed at log-uniform times up to 1 us
+//==============================================================================
+struct LogEntry {
+  const G4MolecularConfiguration* species;
+  double time;
+  int delta;
+};
+
+std::vector<LogEntry> MakePopulation()
+{
+  std::vector<const G4MolecularConfiguration*> species;
+  for (const char* name : {"e_aq", "°OH", "H", "H3Op", "H2", "H2O2", "OHm"}) {
+    auto* conf = G4MoleculeTable::Instance()->GetConfiguration(name, false);
+    if (conf != nullptr) species.push_back(conf);
+  }
+
+  std::vector<LogEntry> entries;
+  if (species.empty()) return entries;
+
+  std::mt19937 engine(67890);
+  std::uniform_real_distribution<double> logt(std::log(1. * ps), std::log(1. * microsecond));
+  for (G4int i = 0; i < options.nspecies; i++) {
+    auto* conf = species[i % species.size()];
+    entries.push_back({conf, 1. * ps, +1});
+    if (i % 2 == 0) entries.push_back({conf, std::exp(logt(engine)), -1});
+  }
+  return entries;
+}
+
+//------------------------------------------------------------------------------
+void RunBenchmarks()
+{
+  auto* species = dynamic_cast<ScoreSpecies*>(FindScorer("Species"));
+  auto* let = FindScorer("LET");
+  auto* killer = dynamic_cast<PrimaryKiller*>(FindScorer("PrimaryKiller"));
+  if (species == nullptr || let == nullptr || killer == nullptr) {
+    G4Exception("RunBenchmarks", "MI_SCORERBENCH_001", FatalException,
+                "The scorers of chem6 are not found.");
+    return;
+  }
+
+  // the primary is killed but the event is never aborted
+  killer->SetMinLossEnergyLimit(10. * keV);
+  killer->SetMaxLossEnergyLimit(DBL_MAX);
+
+  species->ClearTimeToRecord();
+  for (G4int i = 0; i < options.nbins; i++) {
+    species->AddTimeToRecord(
+      options.nbins > 1 ? 1. * ps * std::pow(1e6, double(i) / (options.nbins - 1))
+                        : 1. * microsecond);
+  }
+
+  StepPool steps(1024);
+
+  auto start = Clock::now();
+  for (long i = 0; i < options.ncalls; i++) species->HitPrimitive(steps[i], nullptr);
+  results.push_back({"ScoreSpecies::ProcessHits", options.ncalls, Elapsed(start)});
+
+  start = Clock::now();
+  for (long i = 0; i < options.ncalls; i++) let->HitPrimitive(steps[i], nullptr);
+  results.push_back({"ScoreLET::ProcessHits", options.ncalls, Elapsed(start)});
+
+  start = Clock::now();
+  for (long i = 0; i < options.ncalls; i++) killer->HitPrimitive(steps[i], nullptr);
+  results.push_back({"PrimaryKiller::ProcessHits", options.ncalls, Elapsed(start)});
+
+  // species counted from a reaction log which is not written
+  auto* log = MI::ReactionLog::Instance();
+  log->Enable("");
+  const auto population = MakePopulation();
+  auto fill = [&]() {
+    log->Clear();
+    for (const auto& e : population) log->Record(e.species, e.time, e.delta);
+    species->HitPrimitive(steps[1], nullptr);  // energy deposit of the event
+  };
+
+  double record = 0., end_of_event = 0.;
+  for (G4int i = 0; i < options.nevents; i++) {
+    start = Clock::now();
+    fill();
+    record += Elapsed(start);
+    start = Clock::now();
+    species->EndOfEvent(nullptr);
+    end_of_event += Elapsed(start);
+  }
+  results.push_back({"ReactionLog::Record", long(options.nevents) * long(population.size()),
+                     record});
+  results.push_back({"ScoreSpecies::EndOfEvent (reaction-log path)", options.nevents,
+                     end_of_event});
+
+  // worker results of one event merged into the master ones
+  auto* masterManager = G4RunManagerFactory::GetMasterRunManager();
+  auto* masterRun = static_cast<Run*>(masterManager->GetNonConstCurrentRun());
+  auto* workerRun = static_cast<Run*>(G4RunManager::GetRunManager()->GetNonConstCurrentRun());
+  if (masterRun == nullptr || masterRun == workerRun) {
+    G4cout << "Sequential run: AbsorbResultsFromWorkerScorer and Merge are skipped."
+           << G4endl;
+    return;
+  }
+  auto* masterSpecies = masterRun->GetPrimitiveScorer();
+
+  double absorb = 0., merge = 0.;
+  for (G4int i = 0; i < options.nevents; i++) {
+    fill();
+    species->EndOfEvent(nullptr);
+    start = Clock::now();
+    masterSpecies->AbsorbResultsFromWorkerScorer(species);
+    absorb += Elapsed(start);
+
+    fill();
+    species->EndOfEvent(nullptr);
+    start = Clock::now();
+    masterRun->Merge(workerRun);
+    merge += Elapsed(start);
+  }
+  results.push_back({"ScoreSpecies::AbsorbResultsFromWorkerScorer (reaction-log path)",
+                     options.nevents, absorb});
+  results.push_back({"Run::Merge (reaction-log path)", options.nevents, merge});
+}
+
+//==============================================================================
+class BenchEventAction : public G4UserEventAction {
+public:
+  void BeginOfEventAction(const G4Event* event) override
+  {
+    if (event->GetEventID() != 0) return;
+    RunBenchmarks();
+    // nothing of this event is scored
+    G4RunManager::GetRunManager()->AbortEvent();
+  }
+};
+
+//------------------------------------------------------------------------------
+class BenchGenerator : public G4VUserPrimaryGeneratorAction {
+public:
+  void GeneratePrimaries(G4Event*) override {}
+};
+
+//------------------------------------------------------------------------------
+class BenchRunAction : public G4UserRunAction {
+public:
+  G4Run* GenerateRun() override { return new Run(); }
+  void BeginOfRunAction(const G4Run* run) override
+  {
+    MI::ReactionCounter::Instance()->Initialize(run->GetRunID());
+  }
+};
+
+//------------------------------------------------------------------------------
+class BenchActionInitialization : public G4VUserActionInitialization {
+public:
+  void BuildForMaster() const override { SetUserAction(new BenchRunAction()); }
+
+  void Build() const override
+  {
+    SetUserAction(new BenchGenerator());
+    SetUserAction(new BenchRunAction());
+    SetUserAction(new BenchEventAction());
+  }
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::strcmp(argv[i], "-n") == 0) options.ncalls = std::atol(argv[i + 1]);
+    else if (std::strcmp(argv[i], "-e") == 0) options.nevents = std::atoi(argv[i + 1]);
+    else if (std::strcmp(argv[i], "-b") == 0) options.nbins = std::atoi(argv[i + 1]);
+    else if (std::strcmp(argv[i], "-s") == 0) options.nspecies = std::atoi(argv[i + 1]);
+    else {
+      G4cerr << "usage: chem6_scorerbench [-n calls] [-e events] [-b time bins]"
+                " [-s species]" << G4endl;
+      return 1;
+    }
+  }
+
+  G4Random::setTheEngine(new CLHEP::RanecuEngine);
+
+  // one worker: the worker and master scorers are distinct
+  auto* runManager = G4RunManagerFactory::CreateRunManager();
+  runManager->SetNumberOfThreads(1);
+  runManager->SetUserInitialization(new PhysicsList());
+  runManager->SetUserInitialization(new DetectorConstruction());
+  runManager->SetUserInitialization(new BenchActionInitialization());
+
+  auto* UI = G4UImanager::GetUIpointer();
+  UI->ApplyCommand("/run/initialize");
+  runManager->BeamOn(1);
+
+  G4cout << "\n=============================================" << G4endl;
+  G4cout << " Scorer Microbenchmark (" << options.nbins << " time bins, "
+         << options.nspecies << " species per event)" << G4endl;
+  char line[256];
+  std::snprintf(line, sizeof(line), "%-64s %12s %12s", "function", "calls", "ns/call");
+  G4cout << line << G4endl;
+  for (const auto& result : results) {
+    std::snprintf(line, sizeof(line), "%-64s %12ld %12.1f", result.name, result.calls,
+                  result.calls > 0 ? result.seconds / result.calls * 1e9 : 0.);
+    G4cout << line << G4endl;
+  }
+  G4cout << "=============================================" << G4endl;
+
+  delete runManager;
+  return 0;
+}
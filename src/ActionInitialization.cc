@@ -42,10 +42,12 @@
 
 #include "ActionInitialization.hh"
 
+#include "ITTrackingInteractivity.hh"
 #include "PrimaryGeneratorAction.hh"
 #include "RunAction.hh"
 #include "StackingAction.hh"
 #include "TimeStepAction.hh"
+#include "startup_profiler.hh"
 
 #include "G4DNAChemistryManager.hh"
 #include "G4H2O.hh"
@@ -79,6 +81,12 @@ void ActionInitialization::BuildForMaster() const
 
 void ActionInitialization::Build() const
 {
+  // ended at the first event of the thread (EventAction); in sequential mode
+  // Build() runs on the master before /run/initialize, there is no spin-up
+  if (G4Threading::IsWorkerThread()) {
+    MI::StartupProfiler::Instance()->Begin("thread spin-up");
+  }
+
 #ifndef NEW_MOLECULE_COUNTER
   G4MoleculeCounter::Instance()->Use();
   G4MoleculeCounter::Instance()->DontRegister(G4H2O::Definition());
@@ -92,7 +100,9 @@ void ActionInitialization::Build() const
   SetUserAction(new RunAction());
   SetUserAction(new EventAction());
   SetUserAction(new StackingAction());
-  G4Scheduler::Instance()->SetUserAction(new G4UserTimeStepAction);
+  G4Scheduler::Instance()->SetUserAction(new TimeStepAction());
+  // counts the species for the reaction log and the memory tracker
+  G4Scheduler::Instance()->SetInteractivity(new ITTrackingInteractivity());
 #ifdef NEW_MOLECULE_COUNTER
   BuildMoleculeCounters();
 #endif
@@ -46,6 +46,7 @@
 #include "PrimaryKiller.hh"
 #include "ScoreLET.hh"
 #include "ScoreSpecies.hh"
+#include "startup_profiler.hh"
 
 #include "G4Box.hh"
 #include "G4LogicalVolume.hh"
@@ -70,6 +71,8 @@ DetectorConstruction::~DetectorConstruction() {}
 
 G4VPhysicalVolume* DetectorConstruction::Construct()
 {
+  MI::StartupProfiler::Scope profile("geometry");
+
   // Water is defined from NIST material database
   G4NistManager* man = G4NistManager::Instance();
   G4Material* water = man->FindOrBuildMaterial("G4_WATER");
@@ -107,6 +110,8 @@ G4VPhysicalVolume* DetectorConstruction::Construct()
 
 void DetectorConstruction::ConstructSDandField()
 {
+  MI::StartupProfiler::Scope profile("scorers");
+
   G4SDManager::GetSDMpointer()->SetVerboseLevel(1);
 
   // declare World as a MultiFunctionalDetector scorer
@@ -56,6 +56,10 @@
 #include "G4EmDNAPhysics_option7.hh"
 #include "G4EmDNAPhysics_option8.hh"
 #include "G4EmParameters.hh"
+#include "G4ProductionCuts.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
 #include "G4SystemOfUnits.hh"
 
 // multiple ionisation processes
@@ -66,7 +70,25 @@
 #include "G4DNADoubleIonisation.hh"
 #include "G4DNATripleIonisation.hh"
 #include "G4DNAQuadrupleIonisation.hh"
+#include "G4DNAElectronSolvation.hh"
+#include "G4DNAMolecularDissociation.hh"
+#include "G4DNAWaterDissociationDisplacer.hh"
+#include "G4Electron.hh"
+#include "G4H2O.hh"
+#include "G4ProcessManager.hh"
+#include "G4Threading.hh"
+#include "dna_batched_displacer.hh"
 #include "dna_chemistry.hh"
+#include "dna_molecular_dissociation.hh"
+#include "dna_solvation_table.hh"
+#include "startup_profiler.hh"
+#include "dna_scavenger.hh"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -95,6 +117,7 @@ PhysicsList::~PhysicsList()
 
 void PhysicsList::ConstructParticle()
 {
+  MI::StartupProfiler::Scope profile("particles");
   if (fEmDNAPhysicsList != nullptr) {
     fEmDNAPhysicsList->ConstructParticle();
   }
@@ -107,18 +130,56 @@ void PhysicsList::ConstructParticle()
 
 void PhysicsList::ConstructProcess()
 {
+  // NOTE(SO): the tables are built (or retrieved) by the master only
+  if (!fTableCacheDir.empty() && G4Threading::IsMasterThread()) {
+    auto dir = GetTableCacheDirectory();
+    if (std::filesystem::exists(dir + "/complete")) {
+      G4cout << "Physics tables are retrieved from " << dir << G4endl;
+      SetPhysicsTableRetrieved(dir);
+    }
+    else {
+      fTableCacheToStore = true;
+      fTableCacheStoreDir = dir;
+    }
+  }
+
   AddTransportation();
+  auto* profiler = MI::StartupProfiler::Instance();
   if (fEmDNAPhysicsList != nullptr) {
+    profiler->Begin(fPhysDNAName);
     fEmDNAPhysicsList->ConstructProcess();
-    if (fMIoni) { ConstructMultipleIonisationProcess(); }
+    profiler->End(fPhysDNAName);
+    if (fMIoni) {
+      MI::StartupProfiler::Scope profile("multiple ionisation processes");
+      ConstructMultipleIonisationProcess();
+    }
+    if (fSolvationTable != "off") {
+      MI::StartupProfiler::Scope profile("solvation table");
+      InstallSolvationTable();
+    }
   }
   if (fEmDNAChemistryList != nullptr) {
+    profiler->Begin(fChemDNAName);
     fEmDNAChemistryList->ConstructProcess();
+    profiler->End(fChemDNAName);
+    // NOTE(SO): the displacer is set on the process that is finally used
+    if (fDecayDispatch) { InstallDecayDispatch(); }
+    if (fBatchedDisplacer) { InstallBatchedDisplacer(); }
   }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+void PhysicsList::SetCuts()
+{
+  G4VModularPhysicsList::SetCuts();
+  // NOTE(SO): the tables are built (or retrieved) at the initialisation of
+  // the first run, not here
+  MI::StartupProfiler::Instance()->WatchPhysicsTables();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void PhysicsList::RegisterConstructor(const G4String& name)
 {
   if (name == fPhysDNAName) {
@@ -166,8 +227,10 @@ void PhysicsList::RegisterConstructor(const G4String& name)
   }
   else if (name == "G4EmDNAChemistry") {
     if (fEmDNAChemistryList != nullptr) { fEmDNAChemistryList.reset(); }
-    if (fMIoni) {
-      fEmDNAChemistryList = std::make_unique<MI::DNAChemistry>();
+    if (fMIoni || !MI::DNAScavengerTable::Instance()->IsEmpty()) {
+      auto chem = std::make_unique<MI::DNAChemistry>();
+      chem->UseMultipleIonisation(fMIoni);
+      fEmDNAChemistryList = std::move(chem);
     } else {
       fEmDNAChemistryList = std::make_unique<G4EmDNAChemistry>();
     }
@@ -176,8 +239,10 @@ void PhysicsList::RegisterConstructor(const G4String& name)
   }
   else if (name == "G4EmDNAChemistry_option1") {
     if (fEmDNAChemistryList != nullptr) { fEmDNAChemistryList.reset(); }
-    if (fMIoni) {
-      fEmDNAChemistryList = std::make_unique<MI::DNAChemistryOpt1>();
+    if (fMIoni || !MI::DNAScavengerTable::Instance()->IsEmpty()) {
+      auto chem = std::make_unique<MI::DNAChemistryOpt1>();
+      chem->UseMultipleIonisation(fMIoni);
+      fEmDNAChemistryList = std::move(chem);
     } else {
       fEmDNAChemistryList = std::make_unique<G4EmDNAChemistry_option1>();
     }
@@ -186,8 +251,10 @@ void PhysicsList::RegisterConstructor(const G4String& name)
   }
   else if (name == "G4EmDNAChemistry_option2") {
     if (fEmDNAChemistryList != nullptr) { fEmDNAChemistryList.reset(); }
-    if (fMIoni) {
-      fEmDNAChemistryList = std::make_unique<MI::DNAChemistryOpt2>();
+    if (fMIoni || !MI::DNAScavengerTable::Instance()->IsEmpty()) {
+      auto chem = std::make_unique<MI::DNAChemistryOpt2>();
+      chem->UseMultipleIonisation(fMIoni);
+      fEmDNAChemistryList = std::move(chem);
     } else {
       fEmDNAChemistryList = std::make_unique<G4EmDNAChemistry_option2>();
     }
@@ -196,8 +263,10 @@ void PhysicsList::RegisterConstructor(const G4String& name)
   }
   else if (name == "G4EmDNAChemistry_option3") {
     if (fEmDNAChemistryList != nullptr) { fEmDNAChemistryList.reset(); }
-    if (fMIoni) {
-      fEmDNAChemistryList = std::make_unique<MI::DNAChemistryOpt3>();
+    if (fMIoni || !MI::DNAScavengerTable::Instance()->IsEmpty()) {
+      auto chem = std::make_unique<MI::DNAChemistryOpt3>();
+      chem->UseMultipleIonisation(fMIoni);
+      fEmDNAChemistryList = std::move(chem);
     } else {
       fEmDNAChemistryList = std::make_unique<G4EmDNAChemistry_option3>();
     }
@@ -212,8 +281,35 @@ void PhysicsList::RegisterConstructor(const G4String& name)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+void PhysicsList::AddScavenger(const MI::DNAScavenger& scavenger)
+{
+  MI::DNAScavengerTable::Instance()->Add(scavenger);
+  RegisterConstructor(fChemDNAName); // reset chemistry list
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsList::AddMultipleIonisationParticle(const G4String& name)
+{
+  if (name != "proton" && name != "alpha" && name != "GenericIon") {
+    G4Exception("PhysicsList::AddMultipleIonisationParticle",
+                "MI_PARTICLE_001", FatalErrorInArgument,
+                ("No multiple ionisation process for " + name).c_str());
+    return;
+  }
+  fMIParticles.insert(name);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void PhysicsList::ConstructMultipleIonisationProcess()
 {
+  // NOTE(SO): the processes (and their cross section tables) are only
+  // built for the selected particles
+  auto IsSelected = [this](const G4String& name) {
+    return fMIParticles.empty() || fMIParticles.count(name) > 0;
+  };
+
   auto BuildDoubleIonisation = [](const std::string& name,
                                   G4ParticleDefinition* part) {
     auto* ph = G4PhysicsListHelper::GetPhysicsListHelper();
@@ -239,30 +335,186 @@ void PhysicsList::ConstructMultipleIonisationProcess()
   };
 
   // for protons
-  auto* proton = G4Proton::Proton();
-  BuildDoubleIonisation("proton_G4DNADoubleIonisation", proton);
-  BuildTripleIonisation("proton_G4DNATripleIonisation", proton);
-  BuildQuadrupleIonisation("proton_G4DNAQuadrupleIonisation", proton);
+  if (IsSelected("proton")) {
+    auto* proton = G4Proton::Proton();
+    BuildDoubleIonisation("proton_G4DNADoubleIonisation", proton);
+    BuildTripleIonisation("proton_G4DNATripleIonisation", proton);
+    BuildQuadrupleIonisation("proton_G4DNAQuadrupleIonisation", proton);
+  }
 
   // for alpha particles
-  auto* alphapp = G4Alpha::Alpha();
-  BuildDoubleIonisation("alpha_G4DNADoubleIonisation", alphapp);
-  BuildTripleIonisation("alpha_G4DNATripleIonisation", alphapp);
-  BuildQuadrupleIonisation("alpha_G4DNAQuadrupleIonisation", alphapp);
+  if (IsSelected("alpha")) {
+    auto* alphapp = G4Alpha::Alpha();
+    BuildDoubleIonisation("alpha_G4DNADoubleIonisation", alphapp);
+    BuildTripleIonisation("alpha_G4DNATripleIonisation", alphapp);
+    BuildQuadrupleIonisation("alpha_G4DNAQuadrupleIonisation", alphapp);
+  }
 
   // for carbon ions
-  auto* gion = G4GenericIon::GenericIon();
-  BuildDoubleIonisation("GenericIon_G4DNADoubleIonisation", gion);
-  BuildTripleIonisation("GenericIon_G4DNATripleIonisation", gion);
-  BuildQuadrupleIonisation("GenericIon_G4DNAQuadrupleIonisation", gion);
+  if (IsSelected("GenericIon")) {
+    auto* gion = G4GenericIon::GenericIon();
+    BuildDoubleIonisation("GenericIon_G4DNADoubleIonisation", gion);
+    BuildTripleIonisation("GenericIon_G4DNATripleIonisation", gion);
+    BuildQuadrupleIonisation("GenericIon_G4DNAQuadrupleIonisation", gion);
+  }
 
 #if G4VERSION_NUMBER >= 1132 && G4VERSION_REFERENCE_TAG >= 6
-  // for hydrogen atoms
-  auto* hydrogen = G4DNAGenericIonsManager::Instance()->GetIon("hydrogen");
-  BuildDoubleIonisation("hydrogen_G4DNADoubleIonisation", hydrogen);
-  BuildTripleIonisation("hydrogen_G4DNATripleIonisation", hydrogen);
-  BuildQuadrupleIonisation("hydrogen_G4DNAQuadrupleIonisation", hydrogen);
+  // for hydrogen atoms, produced by the charge exchange of protons
+  if (IsSelected("proton")) {
+    auto* hydrogen = G4DNAGenericIonsManager::Instance()->GetIon("hydrogen");
+    BuildDoubleIonisation("hydrogen_G4DNADoubleIonisation", hydrogen);
+    BuildTripleIonisation("hydrogen_G4DNATripleIonisation", hydrogen);
+    BuildQuadrupleIonisation("hydrogen_G4DNAQuadrupleIonisation", hydrogen);
+  }
 #endif
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsList::InstallBatchedDisplacer()
+{
+  auto* water = G4H2O::Definition();
+  auto* pmanager = water->GetProcessManager();
+  auto* process = pmanager != nullptr
+    ? dynamic_cast<G4DNAMolecularDissociation*>(
+        pmanager->GetProcess("H2O_DNAMolecularDecay"))
+    : nullptr;
+  if (process == nullptr) {
+    G4Exception("PhysicsList::InstallBatchedDisplacer", "MI_DISPLACER_001",
+                JustWarning,
+                "H2O_DNAMolecularDecay is not found, "
+                "the Geant4 displacer is kept.");
+    return;
+  }
+  process->SetDisplacer(water, new MI::DNABatchedDisplacer());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsList::InstallDecayDispatch()
+{
+  auto* water = G4H2O::Definition();
+  auto* pmanager = water->GetProcessManager();
+  auto* process = pmanager != nullptr
+    ? dynamic_cast<G4DNAMolecularDissociation*>(
+        pmanager->GetProcess("H2O_DNAMolecularDecay"))
+    : nullptr;
+  if (process == nullptr) {
+    G4Exception("PhysicsList::InstallDecayDispatch", "MI_DISPATCH_001",
+                JustWarning,
+                "H2O_DNAMolecularDecay is not found, "
+                "the Geant4 decay is kept.");
+    return;
+  }
+
+  // replace the process at the same place in the process vectors
+  const auto at_rest = pmanager->GetProcessOrdering(process, idxAtRest);
+  const auto post_step = pmanager->GetProcessOrdering(process, idxPostStep);
+  // the process manager does not own a removed process; its displacer is
+  // deleted with it
+  delete pmanager->RemoveProcess(process);
+
+  auto* dissociation =
+    new MI::DNAMolecularDissociation("H2O_DNAMolecularDecay");
+  dissociation->SetDisplacer(water, new G4DNAWaterDissociationDisplacer());
+  dissociation->SetVerboseLevel(1);
+  pmanager->AddProcess(dissociation, at_rest, ordInActive, post_step);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+G4String PhysicsList::GetTableCacheDirectory() const
+{
+  // NOTE(SO): the tables also depend on the production cuts, the energy
+  // range of the cuts table and the EM (and DNA) parameters, they are
+  // summed up by a hash of their dump
+  std::ostringstream config;
+  config << std::setprecision(17) << GetDefaultCutValue() << "\n";
+  auto* cutsTable = G4ProductionCutsTable::GetProductionCutsTable();
+  config << cutsTable->GetLowEdgeEnergy() << " "
+         << cutsTable->GetHighEdgeEnergy() << "\n";
+  for (const auto* region : *G4RegionStore::GetInstance()) {
+    config << region->GetName();
+    if (const auto* cuts = region->GetProductionCuts()) {
+      for (auto cut : cuts->GetProductionCuts()) { config << " " << cut; }
+    }
+    config << "\n";
+  }
+  G4EmParameters::Instance()->StreamInfo(config);
+  config << fSolvationTable << "\n";
+
+  // FNV-1a, stable between launches and compilers
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : config.str()) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+
+  std::ostringstream os;
+  os << fTableCacheDir << "/g4" << G4VERSION_NUMBER << "_" << fPhysDNAName
+     << "_" << fChemDNAName << (fMIoni ? "_MI" : "");
+  if (fMIoni) {
+    for (const auto& name : fMIParticles) { os << "_" << name; }
+  }
+  os << "_" << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return os.str();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsList::StoreTableCache()
+{
+  if (!fTableCacheToStore) { return; }
+  fTableCacheToStore = false;
+
+  const auto& dir = fTableCacheStoreDir;
+  std::error_code ec;
+  std::filesystem::create_directories(dir, ec);
+  if (ec || !StorePhysicsTable(dir)) {
+    G4Exception("PhysicsList::StoreTableCache", "MI_TABLE_CACHE_001",
+                JustWarning, ("Physics tables are not stored in " + dir).c_str());
+    return;
+  }
+  // the marker is written last, an interrupted store is not retrieved
+  std::ofstream(dir + "/complete") << G4VERSION_NUMBER << G4endl;
+  G4cout << "Physics tables are stored in " << dir << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void PhysicsList::InstallSolvationTable()
+{
+  auto* electron = G4Electron::Electron();
+  auto* pmanager = electron->GetProcessManager();
+  auto* process = pmanager != nullptr
+    ? dynamic_cast<G4DNAElectronSolvation*>(
+        pmanager->GetProcess("e-_G4DNAElectronSolvation"))
+    : nullptr;
+  if (process == nullptr || process->EmModel() == nullptr) {
+    G4Exception("PhysicsList::InstallSolvationTable", "MI_SOLVATION_002",
+                JustWarning,
+                "e-_G4DNAElectronSolvation is not found, "
+                "the Geant4 thermalisation model is kept.");
+    return;
+  }
+
+  auto* table = MI::DNASolvationTable::Instance();
+  table->Build();
+  if (fSolvationTable == "validate" && G4Threading::IsMasterThread()) {
+    table->Validate(G4cout);
+  }
+
+  // replace the process, keeping the energy limit of the Geant4 model
+  auto* model = new MI::DNATabulatedThermalizationModel();
+  model->SetHighEnergyLimit(process->EmModel()->HighEnergyLimit());
+  // the process manager does not own a removed process; its model stays
+  // owned (and deleted) by G4LossTableManager
+  delete pmanager->RemoveProcess(process);
+
+  auto* solvation = new G4DNAElectronSolvation("e-_G4DNAElectronSolvation");
+  solvation->SetEmModel(model);
+  G4PhysicsListHelper::GetPhysicsListHelper()->RegisterProcess(solvation,
+                                                              electron);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
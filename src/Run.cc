@@ -46,6 +46,9 @@
 
 #include "RunAction.hh"
 #include "ScoreSpecies.hh"
+#include "memory_tracker.hh"
+#include "memory_usage.hh"
+#include "reaction_counter.hh"
 
 #include "G4Event.hh"
 #include "G4HCofThisEvent.hh"
@@ -55,6 +58,7 @@
 #include "G4THitsMap.hh"
 #include "G4VSensitiveDetector.hh"
 
+#include <algorithm>
 #include <map>
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
@@ -78,6 +82,27 @@ Run::~Run() {}
 
 void Run::RecordEvent(const G4Event* event)
 {
+  // reactions of this event, counted by TimeStepAction
+  MI::ReactionCounter::Instance()->Absorb(fReactionCounts);
+
+  // stage times of this event, aborted events included
+  TimeHistory::StageTimes wall, cpu;
+  TimeHistory::GetTimeHistory()->TakeEventStages(wall, cpu);
+  for (G4int i = TimeHistory::kEvent; i <= TimeHistory::kScoring; i++) {
+    if (wall[i] <= 0.) continue;
+    fStageWall[i].Fill(wall[i]);
+    fStageCPU[i].Fill(cpu[i]);
+  }
+
+  // memory footprint of this event
+  fPeakRSS = std::max(fPeakRSS, MI::GetResidentMemory());
+  long peakSpecies = MI::MemoryTracker::Instance()->TakeEventPeakSpecies();
+  if (peakSpecies > 0) {
+    fPeakSpecies = std::max(fPeakSpecies, peakSpecies);
+    fSumPeakSpecies += peakSpecies;
+    fNChemistryEvents++;
+  }
+
   if (event->IsAborted()) return;
 
   G4int CollectionID = G4SDManager::GetSDMpointer()->GetCollectionID("mfDetector/Species");
@@ -122,6 +147,8 @@ void Run::Merge(const G4Run* aRun)
     return;
   }
 
+  TimeHistory::Scope merge(TimeHistory::kMerge);
+
   const Run* localRun = static_cast<const Run*>(aRun);
   fSumEne += localRun->fSumEne;
 
@@ -138,6 +165,25 @@ void Run::Merge(const G4Run* aRun)
   ScoreSpecies* localScorer = dynamic_cast<ScoreSpecies*>(localRun->fScorerRun);
 
   masterScorer->AbsorbResultsFromWorkerScorer(localScorer);
+
+  const auto& localCounts = localRun->fReactionCounts;
+  if (fReactionCounts.size() < localCounts.size()) {
+    fReactionCounts.resize(localCounts.size(), 0);
+  }
+  for (std::size_t i = 0; i < localCounts.size(); i++) {
+    fReactionCounts[i] += localCounts[i];
+  }
+
+  for (G4int i = 0; i < TimeHistory::kNStages; i++) {
+    fStageWall[i].Merge(localRun->fStageWall[i]);
+    fStageCPU[i].Merge(localRun->fStageCPU[i]);
+  }
+
+  fPeakRSS = std::max(fPeakRSS, localRun->fPeakRSS);
+  fPeakSpecies = std::max(fPeakSpecies, localRun->fPeakSpecies);
+  fSumPeakSpecies += localRun->fSumPeakSpecies;
+  fNChemistryEvents += localRun->fNChemistryEvents;
+
   G4Run::Merge(aRun);
 }
 
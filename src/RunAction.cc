@@ -43,13 +43,23 @@
 /// \brief Implementation of the RunAction class
 
 #include "RunAction.hh"
+#include "PhysicsList.hh"
 #include "Run.hh"
+#include "dna_scavenger.hh"
+#include "memory_tracker.hh"
+#include "memory_usage.hh"
+#include "metrics_exporter.hh"
+#include "perf_counters.hh"
+#include "reaction_counter.hh"
+#include "species_filter.hh"
+#include "startup_profiler.hh"
 #include "timehistory.hh" // NOTE(SO): for measurement of processing time
 #include "G4Version.hh"
 
 #include "G4Run.hh"
 #include "G4RunManager.hh"
 #include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
 #include "G4UnitsTable.hh"
 
 #if G4VERSION_NUMBER >= 1140 || \
@@ -64,6 +74,8 @@
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 extern std::ofstream out;
+extern long nProcessedEvents;
+extern double processingTime;
 
 RunAction::RunAction() : G4UserRunAction() {}
 
@@ -84,7 +96,30 @@ G4Run* RunAction::GenerateRun()
 void RunAction::BeginOfRunAction(const G4Run* run)
 {
   // NOTE(SO): start timter
-  if (IsMaster()) { TimeHistory::GetTimeHistory()->TakeSplit("RunOn"); }
+  if (IsMaster()) {
+    auto* timer = TimeHistory::GetTimeHistory();
+    timer->ResetStages();
+    timer->TakeSplit("RunOn");
+    G4cout << "[Startup] master: run " << run->GetRunID() << " starts after "
+           << timer->GetTime("RunOn") - timer->GetTime("Start") << " s, RSS "
+           << MI::GetResidentMemory() << " MB (peak "
+           << MI::GetPeakResidentMemory() << " MB)" << G4endl;
+
+    // the tables are built once the run is initialised
+    auto* plist = const_cast<PhysicsList*>(dynamic_cast<const PhysicsList*>(
+      G4RunManager::GetRunManager()->GetUserPhysicsList()));
+    if (plist != nullptr) { plist->StoreTableCache(); }
+
+    MI::MetricsExporter::Instance()->BeginRun(run->GetRunID(),
+                                              run->GetNumberOfEventToBeProcessed());
+  }
+
+  TimeHistory::GetTimeHistory()->BeginStage(TimeHistory::kRun);
+
+  // heap of this thread, counted from the beginning of the run
+  auto* tracker = MI::MemoryTracker::Instance();
+  tracker->RegisterThread();
+  if (IsMaster()) tracker->ResetRun();
 
 #ifdef NEW_MOLECULE_COUNTER
   // ensure that the chemistry is notified!
@@ -93,6 +128,22 @@ void RunAction::BeginOfRunAction(const G4Run* run)
 #endif
   G4cout << "### Run " << run->GetRunID() << " starts." << G4endl;
 
+  // the scavenger reactions are restored in the shared reaction table by the
+  // master, before the workers start and before the snapshot; the scavenger
+  // material and the dropped species are handled by each worker
+  if (IsMaster()) MI::DNAScavengerTable::Instance()->RestoreReactions();
+  const G4bool worker = !IsMaster() || !G4Threading::IsMultithreadedApplication();
+  if (worker) MI::DNAScavengerTable::Instance()->InstallScavengerMaterial();
+
+  MI::ReactionCounter::Instance()->Initialize(run->GetRunID());
+
+  if (worker) MI::SpeciesFilter::Instance()->Update(run->GetRunID());
+
+  // the time grid depends on the end times set before this run
+  auto* scorer = dynamic_cast<ScoreSpecies*>(
+    static_cast<const Run*>(run)->GetPrimitiveScorer());
+  if (scorer != nullptr) scorer->BuildTimeGrid();
+
   // informs the runManager to save random number seed
   G4RunManager::GetRunManager()->SetRandomNumberStore(false);
 }
@@ -101,6 +152,9 @@ void RunAction::BeginOfRunAction(const G4Run* run)
 
 void RunAction::EndOfRunAction(const G4Run* run)
 {
+  TimeHistory::GetTimeHistory()->EndStage(TimeHistory::kRun);
+  if (IsMaster()) MI::MetricsExporter::Instance()->EndRun();
+
 #ifdef NEW_MOLECULE_COUNTER
   // ensure that the chemistry is notified!
   if (G4DNAChemistryManager::GetInstanceIfExists() != nullptr)
@@ -152,6 +206,16 @@ void RunAction::EndOfRunAction(const G4Run* run)
 
     masterScorer->OutputAndClear();
 
+    // reaction channels per time decade
+    const auto& reactionCounts = chem6Run->GetReactionCounts();
+    if (!reactionCounts.empty()) {
+      auto* reactionCounter = MI::ReactionCounter::Instance();
+      std::ofstream reactionOut("Reactions" + std::to_string(run->GetRunID()) + ".txt");
+      reactionCounter->Print(reactionCounts, reactionOut);
+      G4cout << "Dominant reaction channels:" << G4endl;
+      reactionCounter->Print(reactionCounts, G4cout, 10);
+    }
+
     out << '\n';
 
     // NOTE(SO): stop timter
@@ -159,13 +223,114 @@ void RunAction::EndOfRunAction(const G4Run* run)
     timer->TakeSplit("RunEnd");
     auto elaptime = timer->GetTime("RunEnd") - timer->GetTime("RunOn");
     auto throughput = nofEvents / elaptime * 60.0;
+    nProcessedEvents += nofEvents;
+    processingTime += elaptime;
     G4cout << "\n=============================================" << G4endl;
     G4cout << " Run Summary" << G4endl;
     G4cout << " - Event Number: " << nofEvents << G4endl;
     G4cout << " - Elasped Time: " << elaptime << " (sec)" << G4endl;
     G4cout << " - Throughput:   " << throughput << " (events/min.)" << G4endl;
+    G4cout << " - Stages (summed over the threads):" << G4endl;
+    G4cout << std::setw(18) << "stage" << std::setw(10) << "calls"
+           << std::setw(14) << "total (sec)" << std::setw(14) << "self (sec)"
+           << std::setw(14) << "mean (ms)" << G4endl;
+    auto records = timer->GetStageRecords();
+    for (int i = 0; i < TimeHistory::kNStages; i++) {
+      const auto& record = records[i];
+      if (record.count == 0) continue;
+      G4cout << std::setw(18) << TimeHistory::GetStageName(TimeHistory::Stage(i))
+             << std::setw(10) << record.count << std::setw(14) << record.total
+             << std::setw(14) << record.self << std::setw(14)
+             << record.total / record.count * 1e3 << G4endl;
+    }
+    G4cout << " - Per-event stage times (ms), wall | CPU:" << G4endl;
+    G4cout << std::setw(18) << "stage" << std::setw(10) << "events"
+           << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99"
+           << std::setw(10) << "max" << " |" << std::setw(10) << "p50" << std::setw(10)
+           << "p90" << std::setw(10) << "p99" << std::setw(10) << "max" << G4endl;
+    const auto& wall = chem6Run->GetStageWallTimes();
+    const auto& cpu = chem6Run->GetStageCPUTimes();
+    for (int i = TimeHistory::kEvent; i < TimeHistory::kNStages; i++) {
+      if (wall[i].GetEntries() == 0) continue;
+      G4cout << std::setw(18) << TimeHistory::GetStageName(TimeHistory::Stage(i))
+             << std::setw(10) << wall[i].GetEntries();
+      for (const auto* histogram : {&wall[i], &cpu[i]}) {
+        if (histogram == &cpu[i]) G4cout << " |";
+        G4cout << std::setw(10) << histogram->GetQuantile(0.5) * 1e3 << std::setw(10)
+               << histogram->GetQuantile(0.9) * 1e3 << std::setw(10)
+               << histogram->GetQuantile(0.99) * 1e3 << std::setw(10)
+               << histogram->GetMax() * 1e3;
+      }
+      G4cout << G4endl;
+    }
+    if (MI::PerfCounters::Instance()->IsEnabled()) {
+      G4cout << " - Hardware counters (summed over the threads):" << G4endl;
+      G4cout << std::setw(18) << "stage";
+      for (int j = 0; j < MI::PerfCounters::kNCounters; j++) {
+        G4cout << std::setw(15) << MI::PerfCounters::GetCounterName(MI::PerfCounters::Counter(j));
+      }
+      G4cout << std::setw(8) << "IPC" << G4endl;
+      for (int i = 0; i < TimeHistory::kNStages; i++) {
+        const auto& counters = records[i].counters;
+        if (records[i].count == 0) continue;
+        G4cout << std::setw(18) << TimeHistory::GetStageName(TimeHistory::Stage(i));
+        for (auto value : counters) {
+          if (value < 0.) G4cout << std::setw(15) << "n/a";
+          else G4cout << std::setw(15) << std::setprecision(4) << value;
+        }
+        const double cycles = counters[MI::PerfCounters::kCycles];
+        const double instructions = counters[MI::PerfCounters::kInstructions];
+        if (cycles > 0. && instructions >= 0.)
+          G4cout << std::setw(8) << std::setprecision(3) << instructions / cycles;
+        else
+          G4cout << std::setw(8) << "n/a";
+        G4cout << std::setprecision(6) << G4endl;
+      }
+    }
+    G4cout << " - Memory:" << G4endl;
+    G4cout << "   peak RSS during the run: " << chem6Run->GetPeakRSS()
+           << " MB (process peak " << MI::GetPeakResidentMemory() << " MB)" << G4endl;
+    G4cout << "   live species per event:  peak " << chem6Run->GetPeakSpecies()
+           << ", mean of the event peaks " << chem6Run->GetMeanPeakSpecies() << G4endl;
+    auto* tracker = MI::MemoryTracker::Instance();
+    if (tracker->GetSoftCap() > 0.) {
+      G4cout << "   soft cap " << tracker->GetSoftCap() << " MB: " << tracker->GetNWaits()
+             << " events delayed for " << tracker->GetWaitTime() << " s" << G4endl;
+    }
+    // long format, one value per row: scope is the thread ("master" or the
+    // G4 thread ID) or "run"
+    std::ofstream memoryOut;
+    if (tracker->IsCSVEnabled()) {
+      memoryOut.open("Memory" + std::to_string(run->GetRunID()) + ".csv");
+      memoryOut << "scope,key,value\n";
+    }
+    if (MI::MemoryTracker::IsAvailable()) {
+      G4cout << std::setw(18) << "thread" << std::setw(16) << "allocated (MB)"
+             << std::setw(14) << "allocations" << std::setw(12) << "live (MB)"
+             << std::setw(16) << "peak live (MB)" << G4endl;
+      for (const auto& stats : tracker->GetThreadStats()) {
+        auto name = stats.thread_id < 0 ? std::string("master")
+                                        : std::to_string(stats.thread_id);
+        G4cout << std::setw(18) << name << std::setw(16) << stats.allocated
+               << std::setw(14) << stats.allocations << std::setw(12) << stats.live
+               << std::setw(16) << stats.peak << G4endl;
+        if (memoryOut.is_open()) {
+          memoryOut << name << ",allocated_mb," << stats.allocated << '\n'
+                    << name << ",allocations," << stats.allocations << '\n'
+                    << name << ",live_mb," << stats.live << '\n'
+                    << name << ",peak_live_mb," << stats.peak << '\n';
+        }
+      }
+    }
+    if (memoryOut.is_open()) {
+      memoryOut << "run,peak_rss_mb," << chem6Run->GetPeakRSS() << '\n'
+                << "run,peak_species," << chem6Run->GetPeakSpecies() << '\n'
+                << "run,mean_peak_species," << chem6Run->GetMeanPeakSpecies() << '\n';
+    }
     G4cout << "=============================================" << G4endl;
 
+    // all threads have started their first run by now
+    MI::StartupProfiler::Instance()->Report(G4cout);
   }
   else {
     G4cout << G4endl << "--------------------End of Local Run------------------------" << G4endl
@@ -43,17 +43,25 @@
 /// \brief Implementation of the ScoreSpecies class
 
 #include "ScoreSpecies.hh"
+#include "reaction_log.hh"
+#include "species_set.hh"
+#include "species_filter.hh"
+#include "timehistory.hh"
+#include "tracer.hh"
 
 #include "G4AnalysisManager.hh"
 #include "G4Event.hh"
+#include "G4RunManager.hh"
 #include "G4Scheduler.hh"
 #include "G4TScoreNtupleWriter.hh"
 #include "G4UImessenger.hh"
 #include "G4UnitsTable.hh"
 
 #include <G4EventManager.hh>
+#include <G4H2O.hh>
 #include <G4MolecularConfiguration.hh>
 #include <G4MoleculeCounter.hh>
+#include <G4PhysicalConstants.hh>
 #include <G4SystemOfUnits.hh>
 #include <globals.hh>
 
@@ -81,6 +89,12 @@ ScoreSpecies::ScoreSpecies(G4String name, G4int depth)
     G4UImessenger(),
     fEdep(0),
     fOutputType("root"),  // other options: "csv", "hdf5", "xml"
+    fCheckReactionLog(false),
+    fHandoffTime(0),
+    fKineticsDose(1 * gray),
+    fKineticsEndTime(0),
+    fKineticsRunID(-1),
+    fNOfTimeBins(0),
     fHCID(-1),
     fEvtMap(0)
 {
@@ -91,6 +105,49 @@ ScoreSpecies::ScoreSpecies(G4String name, G4int depth)
 
   fTimeBincmd = new G4UIcmdWithAnInteger("/scorer/species/nOfTimeBins", this);
 
+  fScoreSpeciescmd = new G4UIcmdWithAString("/scorer/species/score", this);
+  fScoreSpeciescmd->SetGuidance("Add a species to the scored species (all by default).");
+  fScoreSpeciescmd->SetGuidance("Unscored species which cannot react are dropped");
+  fScoreSpeciescmd->SetGuidance("from the chemical stage as soon as they are created.");
+  fScoreSpeciescmd->SetParameterName("species", false);
+
+  fReactionLogcmd = new G4UIcmdWithAString("/scorer/species/reactionLog", this);
+  fReactionLogcmd->SetGuidance("Count the species from a log of creations and destructions");
+  fReactionLogcmd->SetGuidance("and write it to <prefix>[_t<thread>].bin (see rebuildG_time.C).");
+  fReactionLogcmd->SetParameterName("prefix", true);
+  fReactionLogcmd->SetDefaultValue("ReactionLog");
+
+  fCheckReactionLogcmd = new G4UIcmdWithABool("/scorer/species/checkReactionLog", this);
+  fCheckReactionLogcmd->SetGuidance("Compare the numbers of species rebuilt from the reaction");
+  fCheckReactionLogcmd->SetGuidance("log with those of the molecule counter at each time bin");
+  fCheckReactionLogcmd->SetGuidance("of each event, a difference is a fatal error (default: false).");
+  fCheckReactionLogcmd->SetParameterName("check", true);
+  fCheckReactionLogcmd->SetDefaultValue(false);
+
+  fSpeciesSetcmd = new G4UIcmdWithAString("/scorer/species/speciesSet", this);
+  fSpeciesSetcmd->SetGuidance("Write the species at the end of the pre-chemical stage");
+  fSpeciesSetcmd->SetGuidance("to <prefix>[_t<thread>].txt (input of chem6_chembench).");
+  fSpeciesSetcmd->SetParameterName("prefix", true);
+  fSpeciesSetcmd->SetDefaultValue("SpeciesSet");
+
+  fKineticsdir = new G4UIdirectory("/scorer/species/kinetics/");
+  fKineticsdir->SetGuidance("Homogeneous kinetics after the IRT stage");
+
+  fHandoffTimecmd = new G4UIcmdWithADoubleAndUnit("/scorer/species/kinetics/handoffTime", this);
+  fHandoffTimecmd->SetGuidance("Species counts at this time are the initial conditions of");
+  fHandoffTimecmd->SetGuidance("the homogeneous kinetics. Set /scheduler/endTime to the same");
+  fHandoffTimecmd->SetGuidance("value in order to stop the IRT stage there.");
+  fHandoffTimecmd->SetUnitCategory("Time");
+
+  fKineticsDosecmd = new G4UIcmdWithADoubleAndUnit("/scorer/species/kinetics/dose", this);
+  fKineticsDosecmd->SetGuidance("Dose converting G values into initial concentrations");
+  fKineticsDosecmd->SetUnitCategory("Dose");
+  fKineticsDosecmd->SetDefaultUnit("Gy");
+
+  fKineticsEndTimecmd = new G4UIcmdWithADoubleAndUnit("/scorer/species/kinetics/endTime", this);
+  fKineticsEndTimecmd->SetGuidance("Last time used by /scorer/species/nOfTimeBins");
+  fKineticsEndTimecmd->SetUnitCategory("Time");
+
   fEdep = 0;
   fNEvent = 0;
   fRunID = 0;
@@ -106,6 +163,14 @@ ScoreSpecies::~ScoreSpecies()
   delete fSpeciesdir;
   delete fAddTimeToRecordcmd;
   delete fTimeBincmd;
+  delete fScoreSpeciescmd;
+  delete fReactionLogcmd;
+  delete fCheckReactionLogcmd;
+  delete fSpeciesSetcmd;
+  delete fHandoffTimecmd;
+  delete fKineticsDosecmd;
+  delete fKineticsEndTimecmd;
+  delete fKineticsdir;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -117,15 +182,58 @@ void ScoreSpecies::SetNewValue(G4UIcommand* command, G4String newValue)
     AddTimeToRecord(cmdTime);
   }
   if (command == fTimeBincmd) {
+    // the grid is built at the beginning of the run, once the end times are known
     ClearTimeToRecord();
-    G4int cmdBins = fTimeBincmd->GetNewIntValue(newValue);
-    G4double timeMin = 1 * ps;
-    G4double timeMax = G4Scheduler::Instance()->GetEndTime() - 1 * ps;
-    G4double timeLogMin = std::log10(timeMin);
-    G4double timeLogMax = std::log10(timeMax);
-    for (G4int i = 0; i < cmdBins; i++) {
-      AddTimeToRecord(std::pow(10, timeLogMin + i * (timeLogMax - timeLogMin) / (cmdBins - 1)));
-    }
+    fTimeGrid.clear();
+    fNOfTimeBins = fTimeBincmd->GetNewIntValue(newValue);
+  }
+  if (command == fReactionLogcmd) {
+    MI::ReactionLog::Instance()->Enable(newValue);
+  }
+  if (command == fCheckReactionLogcmd) {
+    fCheckReactionLog = fCheckReactionLogcmd->GetNewBoolValue(newValue);
+  }
+  if (command == fSpeciesSetcmd) {
+    MI::SpeciesSetWriter::Instance()->Enable(newValue);
+  }
+  if (command == fScoreSpeciescmd) {
+    MI::SpeciesFilter::Instance()->AddScoredSpecies(newValue);
+  }
+  if (command == fHandoffTimecmd) {
+    SetHandoffTime(fHandoffTimecmd->GetNewDoubleValue(newValue));
+  }
+  if (command == fKineticsDosecmd) {
+    fKineticsDose = fKineticsDosecmd->GetNewDoubleValue(newValue);
+  }
+  if (command == fKineticsEndTimecmd) {
+    fKineticsEndTime = fKineticsEndTimecmd->GetNewDoubleValue(newValue);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void ScoreSpecies::BuildTimeGrid()
+{
+  if (fNOfTimeBins <= 0) return;
+
+  // the grid of the previous run is replaced, the times added by hand are kept
+  for (auto time : fTimeGrid) fTimeToRecord.erase(time);
+  fTimeGrid.clear();
+
+  G4double timeMin = 1 * ps;
+  G4double timeMax = G4Scheduler::Instance()->GetEndTime() - 1 * ps;
+  if (fHandoffTime > 0 && fKineticsEndTime > fHandoffTime) {
+    timeMax = fKineticsEndTime;
+  }
+  G4double timeLogMin = std::log10(timeMin);
+  G4double timeLogMax = std::log10(timeMax);
+  for (G4int i = 0; i < fNOfTimeBins; i++) {
+    G4double time =
+      fNOfTimeBins > 1
+        ? std::pow(10, timeLogMin + i * (timeLogMax - timeLogMin) / (fNOfTimeBins - 1))
+        : timeMax;
+    fTimeGrid.insert(time);
+    AddTimeToRecord(time);
   }
 }
 
@@ -156,6 +264,7 @@ void ScoreSpecies::Initialize(G4HCofThisEvent* HCE)
   }
 
   HCE->AddHitsCollection(fHCID, (G4VHitsCollection*)fEvtMap);
+  MI::ReactionLog::Instance()->Clear();
 #ifndef NEW_MOLECULE_COUNTER
   G4MoleculeCounter::Instance()->ResetCounter();
 #endif
@@ -165,6 +274,8 @@ void ScoreSpecies::Initialize(G4HCofThisEvent* HCE)
 
 void ScoreSpecies::EndOfEvent(G4HCofThisEvent*)
 {
+  TimeHistory::Scope scoring(TimeHistory::kScoring);
+
   if (G4EventManager::GetEventManager()->GetConstCurrentEvent()->IsAborted()) {
     fEdep = 0.;
 #ifndef NEW_MOLECULE_COUNTER
@@ -173,6 +284,16 @@ void ScoreSpecies::EndOfEvent(G4HCofThisEvent*)
     return;
   }
 
+  if (MI::ReactionLog::Instance()->IsEnabled()) {
+    CountFromReactionLog();
+    ++fNEvent;
+    fEdep = 0.;
+#ifndef NEW_MOLECULE_COUNTER
+    G4MoleculeCounter::Instance()->ResetCounter();
+#endif
+    return;
+  }
+
 #ifdef NEW_MOLECULE_COUNTER
   // ---------------------------------------------------------------------------
   //  for Geant4-DNA ver. 11.4
@@ -192,8 +313,14 @@ void ScoreSpecies::EndOfEvent(G4HCofThisEvent*)
     fEdep = 0.;
     return;
   }
+  auto* filter = MI::SpeciesFilter::Instance();
+  std::map<Species*, double> nAtHandoff;
   for (auto idx : indices) {
+    // unscored species are only needed for the homogeneous kinetics
+    const bool scored = filter->IsScored(idx.Molecule);
     for (auto time_mol : fTimeToRecord) {
+      if (!scored || (fHandoffTime > 0 && time_mol > fHandoffTime)) break;
+
       double n_mol = counter->GetNbMoleculesAtTime(idx, time_mol);
 
       if (n_mol < 0) {
@@ -201,13 +328,13 @@ void ScoreSpecies::EndOfEvent(G4HCofThisEvent*)
         G4Exception("", "N<0", FatalException, "");
       }
 
-      SpeciesInfo& molInfo = fSpeciesInfoPerTime[time_mol][idx.Molecule];
-      molInfo.fNumber += n_mol;
-      double gValue = (n_mol / (fEdep / eV)) * 100.;
-      molInfo.fG += gValue;
-      molInfo.fG2 += gValue * gValue;
+      AccumulateSpecies(idx.Molecule, time_mol, n_mol);
+    }
+    if (fHandoffTime > 0) {
+      nAtHandoff[idx.Molecule] += counter->GetNbMoleculesAtTime(idx, fHandoffTime);
     }
   }
+  if (fHandoffTime > 0) SolveHomogeneousKinetics(nAtHandoff);
 #else
   // ---------------------------------------------------------------------------
   //  for Geant4-DNA ver. 11.3 or older
@@ -221,20 +348,25 @@ void ScoreSpecies::EndOfEvent(G4HCofThisEvent*)
     G4MoleculeCounter::Instance()->ResetCounter();
     return;
   }
+  auto* filter = MI::SpeciesFilter::Instance();
+  std::map<Species*, double> nAtHandoff;
   for (auto molecule : *species) {
+    // unscored species are only needed for the homogeneous kinetics
+    const bool scored = filter->IsScored(molecule);
     for (auto time_mol : fTimeToRecord) {
+      if (!scored || (fHandoffTime > 0 && time_mol > fHandoffTime)) break;
       double n_mol = G4MoleculeCounter::Instance()->GetNMoleculesAtTime(molecule, time_mol);
       if (n_mol < 0) {
         G4cerr << "N molecules not valid < 0 " << G4endl;
         G4Exception("", "N<0", FatalException, "");
       }
-      SpeciesInfo& molInfo = fSpeciesInfoPerTime[time_mol][molecule];
-      molInfo.fNumber += n_mol;
-      double gValue = (n_mol / (fEdep / eV)) * 100.;
-      molInfo.fG += gValue;
-      molInfo.fG2 += gValue * gValue;
+      AccumulateSpecies(molecule, time_mol, n_mol);
+    }
+    if (fHandoffTime > 0) {
+      nAtHandoff[molecule] = G4MoleculeCounter::Instance()->GetNMoleculesAtTime(molecule, fHandoffTime);
     }
   }
+  if (fHandoffTime > 0) SolveHomogeneousKinetics(nAtHandoff);
 #endif // NEW_MOLECULE_COUNTER
   ++fNEvent;
   fEdep = 0.;
@@ -245,6 +377,160 @@ void ScoreSpecies::EndOfEvent(G4HCofThisEvent*)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
+void ScoreSpecies::CountFromReactionLog()
+{
+  auto* log = MI::ReactionLog::Instance();
+
+  std::set<G4double> times;
+  for (auto time_mol : fTimeToRecord) {
+    if (fHandoffTime > 0 && time_mol > fHandoffTime) break;
+    times.insert(time_mol);
+  }
+  if (fHandoffTime > 0) times.insert(fHandoffTime);
+
+  // a single prefix-sum scan gives the numbers at all the times
+  std::map<double, std::map<Species*, double>> counts;
+  log->CountAtTimes(times, counts);
+
+  G4int eventID = G4EventManager::GetEventManager()->GetConstCurrentEvent()->GetEventID();
+  G4int runID = G4RunManager::GetRunManager()->GetCurrentRun()->GetRunID();
+  log->Write(runID, eventID, fEdep);
+
+  if (counts.empty() || counts.begin()->second.empty()) {
+    G4cout << "No molecule recorded, energy deposited= " << G4BestUnit(fEdep, "Energy") << G4endl;
+    return;
+  }
+
+  // the water molecules are not scored, as with the molecule counter
+  for (auto& it : counts) {
+    for (auto it2 = it.second.begin(); it2 != it.second.end();) {
+      if (it2->first->GetDefinition() == G4H2O::Definition()) {
+        it2 = it.second.erase(it2);
+      }
+      else {
+        ++it2;
+      }
+    }
+  }
+  if (fCheckReactionLog) CheckReactionLog(counts);
+
+  auto* filter = MI::SpeciesFilter::Instance();
+  for (const auto& it : counts) {
+    if (fTimeToRecord.count(it.first) == 0) continue;
+    for (const auto& it2 : it.second) {
+      if (filter->IsScored(it2.first)) AccumulateSpecies(it2.first, it.first, it2.second);
+    }
+  }
+  if (fHandoffTime > 0) SolveHomogeneousKinetics(counts[fHandoffTime]);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void ScoreSpecies::CheckReactionLog(
+  const std::map<double, std::map<Species*, double>>& counts) const
+{
+  auto* filter = MI::SpeciesFilter::Instance();
+  for (const auto& it : counts) {
+    // numbers of the scored species in the molecule counter at this time
+    std::map<Species*, double> expected;
+#ifdef NEW_MOLECULE_COUNTER
+    auto counter = G4MoleculeCounterManager::Instance()->GetMoleculeCounter<G4MoleculeCounter>(0);
+    if (counter == nullptr) return;
+    for (auto idx : counter->GetMapIndices()) {
+      if (!filter->IsScored(idx.Molecule)) continue;
+      expected[idx.Molecule] += counter->GetNbMoleculesAtTime(idx, it.first);
+    }
+#else
+    auto molecules = G4MoleculeCounter::Instance()->GetRecordedMolecules();
+    for (std::size_t i = 0; molecules.get() != 0 && i < molecules->size(); i++) {
+      auto molecule = (*molecules)[i];
+      if (!filter->IsScored(molecule)) continue;
+      expected[molecule] = G4MoleculeCounter::Instance()->GetNMoleculesAtTime(molecule, it.first);
+    }
+#endif
+    std::map<Species*, double> rebuilt;
+    for (const auto& it2 : it.second) {
+      if (filter->IsScored(it2.first) && it2.second != 0.) rebuilt[it2.first] = it2.second;
+    }
+    for (auto itr = expected.begin(); itr != expected.end();) {
+      itr = (itr->second == 0.) ? expected.erase(itr) : std::next(itr);
+    }
+    if (rebuilt == expected) continue;
+
+    G4ExceptionDescription msg;
+    msg << "The reaction log differs from the molecule counter at "
+        << G4BestUnit(it.first, "Time") << " (species: log / counter)";
+    std::set<Species*> species;
+    for (const auto& e : expected) species.insert(e.first);
+    for (const auto& r : rebuilt) species.insert(r.first);
+    for (auto* s : species) {
+      msg << "\n  " << s->GetName() << ": " << (rebuilt.count(s) ? rebuilt[s] : 0.)
+          << " / " << (expected.count(s) ? expected[s] : 0.);
+    }
+    G4Exception("ScoreSpecies::CheckReactionLog", "MI_LOG_003", FatalException, msg);
+    return;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void ScoreSpecies::AccumulateSpecies(Species* species, double time, double n_mol)
+{
+  SpeciesInfo& molInfo = fSpeciesInfoPerTime[time][species];
+  molInfo.fNumber += n_mol;
+  double gValue = (n_mol / (fEdep / eV)) * 100.;
+  molInfo.fG += gValue;
+  molInfo.fG2 += gValue * gValue;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void ScoreSpecies::SolveHomogeneousKinetics(const std::map<Species*, double>& nAtHandoff)
+{
+  // the reaction table may be changed by the user between runs
+  G4int runID = G4RunManager::GetRunManager()->GetCurrentRun()->GetRunID();
+  if (!fKinetics.IsInitialized() || runID != fKineticsRunID) {
+    fKinetics.Initialize();
+    fKineticsRunID = runID;
+  }
+
+  std::vector<double> times;
+  for (auto time_mol : fTimeToRecord) {
+    if (time_mol > fHandoffTime) times.push_back(time_mol);
+  }
+  // no energy, no concentrations: the G values are not defined
+  if (times.empty() || fEdep <= 0) return;
+
+  // G value (molecules / 100 eV) to concentration (mol/L) for the given dose,
+  // assuming a water density of 1 kg/L
+  const double nPer100eV = fEdep / (100 * eV);
+  const double molPerJoule = 1. / (100 * eV / joule * Avogadro * mole);
+  const double factor = molPerJoule * fKineticsDose / gray;
+
+  std::vector<double> conc0(fKinetics.GetNumberOfSpecies(), 0.);
+  for (const auto& it : nAtHandoff) {
+    G4int idx = fKinetics.GetIndex(it.first);
+    if (idx >= 0) conc0[idx] = it.second / nPer100eV * factor;
+  }
+
+  std::vector<std::vector<double>> result;
+  fKinetics.Solve(conc0, fHandoffTime, times, result);
+
+  // only the species already scored in the IRT stage are reported so that
+  // all times share the same list of species
+  auto* filter = MI::SpeciesFilter::Instance();
+  for (const auto& it : nAtHandoff) {
+    if (!filter->IsScored(it.first)) continue;
+    G4int idx = fKinetics.GetIndex(it.first);
+    for (std::size_t i = 0; i < times.size(); i++) {
+      double n_mol = idx >= 0 ? result[i][idx] / factor * nPer100eV : it.second;
+      AccumulateSpecies(it.first, times[i], n_mol);
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
 void ScoreSpecies::AbsorbResultsFromWorkerScorer(G4VPrimitiveScorer* workerScorer)
 {
   auto right =
@@ -257,6 +543,8 @@ void ScoreSpecies::AbsorbResultsFromWorkerScorer(G4VPrimitiveScorer* workerScore
     return;
   }
 
+  TimeHistory::Scope absorb(TimeHistory::kAbsorb);
+
   auto it_map1 = right->fSpeciesInfoPerTime.begin();
   auto end_map1 = right->fSpeciesInfoPerTime.end();
 
@@ -306,6 +594,7 @@ void ScoreSpecies::PrintAll()
 void ScoreSpecies::OutputAndClear()
 {
   if (G4Threading::IsWorkerThread()) return;
+  MI::Tracer::Scope trace("output");
 
   //---------------------------------------------------------------------------
   // Save results
@@ -43,6 +43,7 @@
 /// \brief Implementation of the StackingAction class
 
 #include "StackingAction.hh"
+#include "timehistory.hh"
 
 #include "G4DNAChemistryManager.hh"
 #include "G4SDManager.hh"
@@ -63,6 +64,11 @@ void StackingAction::NewStage()
 {
   if (stackManager->GetNTotalTrack() == 0) {
     //    G4cout << "Physics stage ends" << G4endl;
+    auto* timer = TimeHistory::GetTimeHistory();
+    timer->EndStage(TimeHistory::kPhysics);
+    TimeHistory::Scope chemistry(TimeHistory::kChemistry);
+    // ended after the first time step (TimeStepAction)
+    timer->BeginStage(TimeHistory::kPreChemistry);
     G4DNAChemistryManager::Instance()->Run();  // starts chemistry
   }
 }
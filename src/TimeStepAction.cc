@@ -43,7 +43,18 @@
 /// \brief Implementation of the TimeStepAction class
 
 #include "TimeStepAction.hh"
-
+#include "ITTrackingInteractivity.hh"
+#include "reaction_counter.hh"
+#include "species_filter.hh"
+#include "species_set.hh"
+#include "timehistory.hh"
+
+#include "G4Event.hh"
+#include "G4EventManager.hh"
+#include "G4H2O.hh"
+#include "G4ITTrackHolder.hh"
+#include "G4Molecule.hh"
+#include "G4Scheduler.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4UnitsTable.hh"
 
@@ -82,12 +93,57 @@ TimeStepAction& TimeStepAction::operator=(const TimeStepAction& rhs)
   return *this;
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void TimeStepAction::StartProcessing()
+{
+  fPreChemistry = true;
+
+  // the species are counted as the scheduler tracks them
+  auto* tracking =
+    dynamic_cast<ITTrackingInteractivity*>(G4Scheduler::Instance()->GetInteractivity());
+  if (tracking != nullptr) tracking->Clear();
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 void TimeStepAction::UserPreTimeStepAction() {}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
-void TimeStepAction::UserPostTimeStepAction() {}
+void TimeStepAction::UserPostTimeStepAction()
+{
+  if (fPreChemistry) {
+    fPreChemistry = false;
+    TimeHistory::GetTimeHistory()->EndStage(TimeHistory::kPreChemistry);
+    RecordSpeciesSet();
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void TimeStepAction::RecordSpeciesSet()
+{
+  auto* writer = MI::SpeciesSetWriter::Instance();
+  if (!writer->IsEnabled()) return;
+
+  // the water molecules have dissociated in the first step: the killed
+  // tracks and the remaining water molecules are not chemical species
+  auto add = [writer](G4Track* track) {
+    auto status = track->GetTrackStatus();
+    if (status == fStopAndKill || status == fKillTrackAndSecondaries) return;
+    if (GetMolecule(track)->GetDefinition() == G4H2O::Definition()) return;
+    writer->Add(track);
+  };
+  auto* holder = G4ITTrackHolder::Instance();
+  for (auto* track : *holder->GetMainList()) add(track);
+  for (auto* track : *holder->GetSecondariesList()) add(track);
+  for (auto& delayed : holder->GetDelayedLists()) {
+    for (auto& list : delayed.second) {
+      for (auto* track : *list.second) add(track);
+    }
+  }
+  writer->Write(G4EventManager::GetEventManager()->GetConstCurrentEvent()->GetEventID());
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
@@ -95,10 +151,30 @@ void TimeStepAction::Clear() {}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
-void TimeStepAction::UserReactionAction(const G4Track& /*trackA*/, const G4Track& /*trackB*/,
-                                        const std::vector<G4Track*>* /*products*/)
+void TimeStepAction::UserReactionAction(const G4Track& trackA, const G4Track& trackB,
+                                        const std::vector<G4Track*>* products)
 {
   //  G4cout<<trackA.GetTrackID()<<" + "<<trackB.GetTrackID()<<'\n';
+
+  G4double time = G4Scheduler::Instance()->GetGlobalTime();
+  auto* speciesA = GetMolecule(trackA)->GetMolecularConfiguration();
+  // pseudo-first-order (scavenger) reactions have a single reactant
+  auto* speciesB =
+    (&trackB != &trackA) ? GetMolecule(trackB)->GetMolecularConfiguration() : nullptr;
+
+  MI::ReactionCounter::Instance()->Count(speciesA, speciesB, time);
+
+  // the reactants and products are logged by ITTrackingInteractivity
+  if (products == nullptr) return;
+
+  // products which are not scored and cannot react any more are dropped
+  auto* filter = MI::SpeciesFilter::Instance();
+  if (!filter->HasScoredSpecies()) return;
+  for (auto* product : *products) {
+    if (filter->IsDropped(GetMolecule(product)->GetMolecularConfiguration())) {
+      product->SetTrackStatus(fStopAndKill);
+    }
+  }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
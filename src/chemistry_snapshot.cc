@@ -0,0 +1,138 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "chemistry_snapshot.hh"
+#include "startup_profiler.hh"
+#include "G4DNAMolecularReactionTable.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4MoleculeTable.hh"
+
+#include <memory>
+#include <mutex>
+
+namespace MI {
+
+std::atomic<const ChemistrySnapshot*> ChemistrySnapshot::instance_{nullptr};
+
+//------------------------------------------------------------------------------
+void ChemistrySnapshot::Build(G4int run_id)
+{
+  static std::mutex mutex;
+  // all the snapshots, the threads may still hold the previous one
+  static std::vector<std::unique_ptr<ChemistrySnapshot>> snapshots;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto* current = Get();
+  if (current != nullptr && current->run_id_ == run_id) { return; }
+
+  // NOTE(SO): the reaction table is empty until the chemistry is
+  // initialised, the snapshot is then built by a later call
+  auto* table = G4DNAMolecularReactionTable::Instance();
+  if (table->GetAllReactionData().empty()) { return; }
+
+  StartupProfiler::Scope profile("chemistry snapshot");
+  snapshots.emplace_back(new ChemistrySnapshot());
+  auto* snapshot = snapshots.back().get();
+  snapshot->run_id_ = run_id;
+
+  auto itr = G4MoleculeTable::Instance()->GetConfigurationIterator();
+  itr.reset();
+  while (itr()) {
+    Species* conf = itr.value();
+    const auto id = static_cast<std::size_t>(conf->GetMoleculeID());
+    if (snapshot->species_.size() <= id) { snapshot->species_.resize(id + 1); }
+
+    auto& data = snapshot->species_[id];
+    data.species = conf;
+    data.diffusion_coefficient = conf->GetDiffusionCoefficient();
+    data.radius = conf->GetVanDerVaalsRadius();
+    data.charge = conf->GetCharge();
+    auto* reactants = table->CanReactWith(conf);
+    data.reactive = reactants != nullptr && !reactants->empty();
+  }
+
+  const std::size_t n = snapshot->species_.size();
+  snapshot->matrix_.assign(n * n, -1);
+
+  // the reaction data map is ordered by the (shared) reactant pointers and
+  // symmetric, each reaction is stored once in the order of the map
+  for (const auto& it1 : table->GetAllReactionData()) {
+    for (const auto& it2 : it1.second) {
+      const auto* data = it2.second;
+      if (data == nullptr) { continue; }
+      const G4int id1 = data->GetReactant1()->GetMoleculeID();
+      const G4int id2 = data->GetReactant2()->GetMoleculeID();
+      if (snapshot->matrix_[id1 * n + id2] >= 0) { continue; }
+
+      ReactionData reaction;
+      reaction.reactant1 = id1;
+      reaction.reactant2 = id2;
+      reaction.type = data->GetReactionType();
+      reaction.rate_constant = data->GetObservedReactionRateConstant();
+      reaction.reaction_radius = data->GetEffectiveReactionRadius();
+
+      G4String name = data->GetReactant1()->GetName() + " + "
+                    + data->GetReactant2()->GetName() + " ->";
+      for (G4int i = 0; i < data->GetNbProducts(); i++) {
+        name += (i == 0 ? " " : " + ") + data->GetProduct(i)->GetName();
+        if (i < kMaxProducts) {
+          reaction.products[i] = data->GetProduct(i)->GetMoleculeID();
+          reaction.nproducts++;
+        }
+      }
+      if (data->GetNbProducts() == 0) { name += " none"; }
+
+      const auto index = static_cast<G4int>(snapshot->reactions_.size());
+      snapshot->matrix_[id1 * n + id2] = index;
+      snapshot->matrix_[id2 * n + id1] = index;
+      snapshot->reactions_.push_back(reaction);
+      snapshot->names_.push_back(name);
+    }
+  }
+
+  instance_.store(snapshot, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+bool ChemistrySnapshot::IsReactive(Species* species) const
+{
+  if (species == nullptr) { return false; }
+  const auto id = static_cast<std::size_t>(species->GetMoleculeID());
+  return id < species_.size() && species_[id].reactive;
+}
+
+//------------------------------------------------------------------------------
+G4int ChemistrySnapshot::FindReaction(Species* reactant1,
+                                      Species* reactant2) const
+{
+  const auto n = species_.size();
+  const auto id1 = static_cast<std::size_t>(reactant1->GetMoleculeID());
+  const auto id2 = static_cast<std::size_t>(reactant2->GetMoleculeID());
+  if (id1 >= n || id2 >= n) { return -1; }
+  return matrix_[id1 * n + id2];
+}
+
+} // end of namespace MI
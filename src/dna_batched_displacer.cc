@@ -0,0 +1,114 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "dna_batched_displacer.hh"
+#include "G4MolecularDissociationChannel.hh"
+#include "G4Version.hh"
+#include "Randomize.hh"
+#include "CLHEP/Random/MixMaxRng.h"
+
+#include <array>
+#include <cmath>
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+bool DNABatchedDisplacer::IsBatched(DisplacementType type)
+{
+  if (type == B1A1_DissociationDecay || type == B1A1_DissociationDecay2) {
+    return true;
+  }
+#if G4VERSION_NUMBER >= 1130
+  if (type == DoubleIonisation_DissociationDecay1 ||
+      type == DoubleIonisation_DissociationDecay2 ||
+      type == DoubleIonisation_DissociationDecay3 ||
+      type == TripleIonisation_DissociationDecay ||
+      type == QuadrupleIonisation_DissociationDecay) {
+    return true;
+  }
+#endif
+  return false;
+}
+
+//------------------------------------------------------------------------------
+const std::vector<G4double>& DNABatchedDisplacer::GetRMS(
+  const G4MolecularDissociationChannel* channel) const
+{
+  const auto type = channel->GetDisplacementType();
+  auto itr = rms_.find(type);
+  if (itr != rms_.end()) { return itr->second; }
+
+  // calibrate with a private engine, the event engine is restored afterwards
+  // NOTE(SO): the Gaussian cached by G4RandGauss is shared by both engines,
+  // so the event sequence is shifted by the calibration
+  auto* engine = G4Random::getTheEngine();
+  CLHEP::MixMaxRng calibration_engine(static_cast<long>(type) + 1);
+  G4Random::setTheEngine(&calibration_engine);
+
+  const auto nproducts = static_cast<std::size_t>(channel->GetNbProducts());
+  std::vector<G4double> sum2(nproducts, 0.);
+  for (int i = 0; i < kNCalibrations; i++) {
+    auto displacements =
+      G4DNAWaterDissociationDisplacer::GetProductsDisplacement(channel);
+    for (std::size_t j = 0; j < nproducts && j < displacements.size(); j++) {
+      sum2[j] += displacements[j].mag2();
+    }
+  }
+  G4Random::setTheEngine(engine);
+
+  auto& rms = rms_[type];
+  for (auto s : sum2) { rms.push_back(std::sqrt(s / kNCalibrations)); }
+  return rms;
+}
+
+//------------------------------------------------------------------------------
+std::vector<G4ThreeVector> DNABatchedDisplacer::GetProductsDisplacement(
+  const G4MolecularDissociationChannel* channel) const
+{
+  const auto nproducts = channel->GetNbProducts();
+  if (!IsBatched(channel->GetDisplacementType()) ||
+      nproducts > kMaxProducts) {
+    return G4DNAWaterDissociationDisplacer::GetProductsDisplacement(channel);
+  }
+
+  const auto& rms = GetRMS(channel);
+
+  // three standard normal numbers per product: the direction is isotropic
+  // and the distance follows a chi distribution of 3 degrees of freedom
+  std::array<G4double, 3 * kMaxProducts> gauss;
+  G4RandGauss::shootArray(3 * nproducts, gauss.data(), 0., 1.);
+
+  std::vector<G4ThreeVector> displacements(nproducts);
+  for (int i = 0; i < nproducts; i++) {
+    const G4double sigma = rms[i] / std::sqrt(3.);
+    displacements[i].set(sigma * gauss[3 * i], sigma * gauss[3 * i + 1],
+                         sigma * gauss[3 * i + 2]);
+  }
+  return displacements;
+}
+
+} // end of namespace MI
@@ -27,6 +27,8 @@
 ==============================================================================*/
 #include "dna_chemistry.hh"
 #include "dna_dissociation_channel.hh"
+#include "dna_scavenger.hh"
+#include "startup_profiler.hh"
 #include "G4PhysicsConstructorFactory.hh"
 
 namespace MI {
@@ -39,29 +41,77 @@ G4_DECLARE_PHYSCONSTR_FACTORY(DNAChemistryOpt3);
 //------------------------------------------------------------------------------
 void DNAChemistry::ConstructDissociationChannels()
 {
+  if (!use_multiple_ionisation_) {
+    G4EmDNAChemistry::ConstructDissociationChannels();
+    return;
+  }
   DNADissociationChannel::ConstructDissociationChannels(
     use_alt_B1A1_decay_, use_alt_decay_vibH2O_);
 }
 
+//------------------------------------------------------------------------------
+void DNAChemistry::ConstructReactionTable(G4DNAMolecularReactionTable* table)
+{
+  StartupProfiler::Scope profile("reaction table");
+  G4EmDNAChemistry::ConstructReactionTable(table);
+  DNAScavengerTable::Instance()->ConstructReactions(table);
+}
+
 //------------------------------------------------------------------------------
 void DNAChemistryOpt1::ConstructDissociationChannels()
 {
+  if (!use_multiple_ionisation_) {
+    G4EmDNAChemistry_option1::ConstructDissociationChannels();
+    return;
+  }
   DNADissociationChannel::ConstructDissociationChannels(
     use_alt_B1A1_decay_, use_alt_decay_vibH2O_);
 }
 
+//------------------------------------------------------------------------------
+void DNAChemistryOpt1::ConstructReactionTable(G4DNAMolecularReactionTable* table)
+{
+  StartupProfiler::Scope profile("reaction table");
+  G4EmDNAChemistry_option1::ConstructReactionTable(table);
+  DNAScavengerTable::Instance()->ConstructReactions(table);
+}
+
 //------------------------------------------------------------------------------
 void DNAChemistryOpt2::ConstructDissociationChannels()
 {
+  if (!use_multiple_ionisation_) {
+    G4EmDNAChemistry_option2::ConstructDissociationChannels();
+    return;
+  }
   DNADissociationChannel::ConstructDissociationChannels(
     use_alt_B1A1_decay_, use_alt_decay_vibH2O_);
 }
 
+//------------------------------------------------------------------------------
+void DNAChemistryOpt2::ConstructReactionTable(G4DNAMolecularReactionTable* table)
+{
+  StartupProfiler::Scope profile("reaction table");
+  G4EmDNAChemistry_option2::ConstructReactionTable(table);
+  DNAScavengerTable::Instance()->ConstructReactions(table);
+}
+
 //------------------------------------------------------------------------------
 void DNAChemistryOpt3::ConstructDissociationChannels()
 {
+  if (!use_multiple_ionisation_) {
+    G4EmDNAChemistry_option3::ConstructDissociationChannels();
+    return;
+  }
   DNADissociationChannel::ConstructDissociationChannels(
     use_alt_B1A1_decay_, use_alt_decay_vibH2O_);
 }
 
+//------------------------------------------------------------------------------
+void DNAChemistryOpt3::ConstructReactionTable(G4DNAMolecularReactionTable* table)
+{
+  StartupProfiler::Scope profile("reaction table");
+  G4EmDNAChemistry_option3::ConstructReactionTable(table);
+  DNAScavengerTable::Instance()->ConstructReactions(table);
+}
+
 } // end of namespace MI
@@ -26,6 +26,8 @@
   EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ==============================================================================*/
 #include "dna_dissociation_channel.hh"
+#include "dna_ionisation_configuration.hh"
+#include "startup_profiler.hh"
 #include "G4Version.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
@@ -34,12 +36,36 @@
 #include "G4MoleculeTable.hh"
 #include "G4H2O.hh"
 
+#include <atomic>
+
 namespace MI {
 
 //------------------------------------------------------------------------------
 void DNADissociationChannel::ConstructDissociationChannels(
   bool alt_B1A1_decay, bool alt_decay_vibH2O)
 {
+  // NOTE(SO): the configurations and channels belong to the shared water
+  // definition. They are built once (by the master in MT mode) and the
+  // workers only read them. A later call must ask for the same channels.
+  static std::atomic<int> constructed{-1};
+  const int options = (alt_B1A1_decay ? 1 : 0) | (alt_decay_vibH2O ? 2 : 0);
+  int expected = -1;
+  if (!constructed.compare_exchange_strong(expected, options)) {
+    if (expected != options) {
+      G4ExceptionDescription msg;
+      msg << "The dissociation channels are already built with "
+          << "alt_B1A1_decay = " << ((expected & 1) != 0)
+          << ", alt_decay_vibH2O = " << ((expected & 2) != 0)
+          << "; they cannot be rebuilt with alt_B1A1_decay = "
+          << alt_B1A1_decay << ", alt_decay_vibH2O = " << alt_decay_vibH2O;
+      G4Exception("MI::DNADissociationChannel::ConstructDissociationChannels",
+                  "MI_DISSOCIATION_001", FatalException, msg);
+    }
+    return;
+  }
+
+  StartupProfiler::Scope profile("dissociation channels");
+
   auto mtab = G4MoleculeTable::Instance();
 
   // Get the molecular configuration
@@ -304,35 +330,8 @@ void DNADissociationChannel::ConstructDissociationChannels(
   decCh1->SetDisplacementType(
     G4DNAWaterDissociationDisplacer::Ionisation_DissociationDecay);
 
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  // this is a ionized h2O with a hole in its last orbital
-  water->NewConfigurationWithElectronOccupancy("SingleIonisation5", *occ);
-  water->AddDecayChannel("SingleIonisation5", decCh1);
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("SingleIonisation4", *occ);
-  water->AddDecayChannel("SingleIonisation4",
-      new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("SingleIonisation3", *occ);
-  water->AddDecayChannel("SingleIonisation3",
-      new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("SingleIonisation2", *occ);
-  water->AddDecayChannel("SingleIonisation2",
-      new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("SingleIonisation1", *occ);
-  water->AddDecayChannel("SingleIonisation1",
-      new G4MolecularDissociationChannel(*decCh1));
+  // SingleIonisation5, ..., SingleIonisation1: a hole in the 5th, ..., 1st shell
+  DNAIonisationConfigurationTable::Register(water, 1, {decCh1});
 
 #if G4VERSION_NUMBER >= 1130
   //////////////////////////////////////////////////////////////////////////////
@@ -368,162 +367,8 @@ void DNADissociationChannel::ConstructDissociationChannels(
   decCh3->SetDisplacementType(
     G4DNAWaterDissociationDisplacer::DoubleIonisation_DissociationDecay3);
 
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation15", *occ);
-  water->AddDecayChannel("DoubleIonisation15", decCh1);
-  water->AddDecayChannel("DoubleIonisation15", decCh2);
-  water->AddDecayChannel("DoubleIonisation15", decCh3);
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation14", *occ);
-  water->AddDecayChannel("DoubleIonisation14",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation14",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation14",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation13", *occ);
-  water->AddDecayChannel("DoubleIonisation13",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation13",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation13",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation12", *occ);
-  water->AddDecayChannel("DoubleIonisation12",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation12",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation12",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation11", *occ);
-  water->AddDecayChannel("DoubleIonisation11",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation11",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation11",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation10", *occ);
-  water->AddDecayChannel("DoubleIonisation10",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation10",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation10",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation9", *occ);
-  water->AddDecayChannel("DoubleIonisation9",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation9",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation9",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation8", *occ);
-  water->AddDecayChannel("DoubleIonisation8",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation8",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation8",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation7", *occ);
-  water->AddDecayChannel("DoubleIonisation7",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation7",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation7",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation6", *occ);
-  water->AddDecayChannel("DoubleIonisation6",
-                        new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation6",
-                        new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation6",
-                        new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation5", *occ);
-  water->AddDecayChannel("DoubleIonisation5",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation5",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation5",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation4", *occ);
-  water->AddDecayChannel("DoubleIonisation4",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation4",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation4",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation3", *occ);
-  water->AddDecayChannel("DoubleIonisation3",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation3",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation3",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation2", *occ);
-  water->AddDecayChannel("DoubleIonisation2",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation2",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation2",
-                         new G4MolecularDissociationChannel(*decCh3));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("DoubleIonisation1", *occ);
-  water->AddDecayChannel("DoubleIonisation1",
-                         new G4MolecularDissociationChannel(*decCh1));
-  water->AddDecayChannel("DoubleIonisation1",
-                         new G4MolecularDissociationChannel(*decCh2));
-  water->AddDecayChannel("DoubleIonisation1",
-                         new G4MolecularDissociationChannel(*decCh3));
+  // DoubleIonisation15, ..., DoubleIonisation1
+  DNAIonisationConfigurationTable::Register(water, 2, {decCh1, decCh2, decCh3});
 
   //////////////////////////////////////////////////////////////////////////////
   // TRIPLE-IONISATION
@@ -540,224 +385,8 @@ void DNADissociationChannel::ConstructDissociationChannels(
   decCh1->SetDisplacementType(
     G4DNAWaterDissociationDisplacer::TripleIonisation_DissociationDecay);
 
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation30", *occ);
-  water->AddDecayChannel("TripleIonisation30", decCh1);
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation29", *occ);
-  water->AddDecayChannel("TripleIonisation29",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation28", *occ);
-  water->AddDecayChannel("TripleIonisation28",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation27", *occ);
-  water->AddDecayChannel("TripleIonisation27",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation26", *occ);
-  water->AddDecayChannel("TripleIonisation26",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation25", *occ);
-  water->AddDecayChannel("TripleIonisation25",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation24", *occ);
-  water->AddDecayChannel("TripleIonisation24",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation23", *occ);
-  water->AddDecayChannel("TripleIonisation23",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation22", *occ);
-  water->AddDecayChannel("TripleIonisation22",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation21", *occ);
-  water->AddDecayChannel("TripleIonisation21",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 2);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation20", *occ);
-  water->AddDecayChannel("TripleIonisation20",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 2);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation19", *occ);
-  water->AddDecayChannel("TripleIonisation19",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 2);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation18", *occ);
-  water->AddDecayChannel("TripleIonisation18",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(4, 2);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation17", *occ);
-  water->AddDecayChannel("TripleIonisation17",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 2);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation16", *occ);
-  water->AddDecayChannel("TripleIonisation16",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 2);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation15", *occ);
-  water->AddDecayChannel("TripleIonisation15",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 2);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation14", *occ);
-  water->AddDecayChannel("TripleIonisation14",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 2);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation13", *occ);
-  water->AddDecayChannel("TripleIonisation13",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation12", *occ);
-  water->AddDecayChannel("TripleIonisation12",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation11", *occ);
-  water->AddDecayChannel("TripleIonisation11",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation10", *occ);
-  water->AddDecayChannel("TripleIonisation10",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation9", *occ);
-  water->AddDecayChannel("TripleIonisation9",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation8", *occ);
-  water->AddDecayChannel("TripleIonisation8",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation7", *occ);
-  water->AddDecayChannel("TripleIonisation7",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation6", *occ);
-  water->AddDecayChannel("TripleIonisation6",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(0, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation5", *occ);
-  water->AddDecayChannel("TripleIonisation5",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation4", *occ);
-  water->AddDecayChannel("TripleIonisation4",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation3", *occ);
-  water->AddDecayChannel("TripleIonisation3",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(2, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation2", *occ);
-  water->AddDecayChannel("TripleIonisation2",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(1, 1);
-  water->NewConfigurationWithElectronOccupancy("TripleIonisation1", *occ);
-  water->AddDecayChannel("TripleIonisation1",
-                         new G4MolecularDissociationChannel(*decCh1));
+  // TripleIonisation30, ..., TripleIonisation1
+  DNAIonisationConfigurationTable::Register(water, 3, {decCh1});
 
   //////////////////////////////////////////////////////////////////////////////
   // QUADRUPLE-IONISATION
@@ -776,359 +405,8 @@ void DNADissociationChannel::ConstructDissociationChannels(
   decCh1->SetDisplacementType(
     G4DNAWaterDissociationDisplacer::QuadrupleIonisation_DissociationDecay);
 
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation1", *occ);
-  water->AddDecayChannel("QuadrupleIonisation1", decCh1);
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation2", *occ);
-  water->AddDecayChannel("QuadrupleIonisation2",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation3", *occ);
-  water->AddDecayChannel("QuadrupleIonisation3",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation4", *occ);
-  water->AddDecayChannel("QuadrupleIonisation4",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation5", *occ);
-  water->AddDecayChannel("QuadrupleIonisation5",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation6", *occ);
-  water->AddDecayChannel("QuadrupleIonisation6",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation7", *occ);
-  water->AddDecayChannel("QuadrupleIonisation7",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation8", *occ);
-  water->AddDecayChannel("QuadrupleIonisation8",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation9", *occ);
-  water->AddDecayChannel("QuadrupleIonisation9",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation10", *occ);
-  water->AddDecayChannel("QuadrupleIonisation10",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation11", *occ);
-  water->AddDecayChannel("QuadrupleIonisation11",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation12", *occ);
-  water->AddDecayChannel("QuadrupleIonisation12",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation13", *occ);
-  water->AddDecayChannel("QuadrupleIonisation13",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation14", *occ);
-  water->AddDecayChannel("QuadrupleIonisation14",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation15", *occ);
-  water->AddDecayChannel("QuadrupleIonisation15",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation16", *occ);
-  water->AddDecayChannel("QuadrupleIonisation16",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation17", *occ);
-  water->AddDecayChannel("QuadrupleIonisation17",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation18", *occ);
-  water->AddDecayChannel("QuadrupleIonisation18",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation19", *occ);
-  water->AddDecayChannel("QuadrupleIonisation19",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation20", *occ);
-  water->AddDecayChannel("QuadrupleIonisation20",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation21", *occ);
-  water->AddDecayChannel("QuadrupleIonisation21",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation22", *occ);
-  water->AddDecayChannel("QuadrupleIonisation22",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation23", *occ);
-  water->AddDecayChannel("QuadrupleIonisation23",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation24", *occ);
-  water->AddDecayChannel("QuadrupleIonisation24",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation25", *occ);
-  water->AddDecayChannel("QuadrupleIonisation25",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation26", *occ);
-  water->AddDecayChannel("QuadrupleIonisation26",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation27", *occ);
-  water->AddDecayChannel("QuadrupleIonisation27",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation28", *occ);
-  water->AddDecayChannel("QuadrupleIonisation28",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation29", *occ);
-  water->AddDecayChannel("QuadrupleIonisation29",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation30", *occ);
-  water->AddDecayChannel("QuadrupleIonisation30",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation31", *occ);
-  water->AddDecayChannel("QuadrupleIonisation31",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation32", *occ);
-  water->AddDecayChannel("QuadrupleIonisation32",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(0, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation33", *occ);
-  water->AddDecayChannel("QuadrupleIonisation33",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation34", *occ);
-  water->AddDecayChannel("QuadrupleIonisation34",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 1);
-  occ->RemoveElectron(4, 1);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation35", *occ);
-  water->AddDecayChannel("QuadrupleIonisation35",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(1, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation36", *occ);
-  water->AddDecayChannel("QuadrupleIonisation36",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation37", *occ);
-  water->AddDecayChannel("QuadrupleIonisation37",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation38", *occ);
-  water->AddDecayChannel("QuadrupleIonisation38",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(0, 2);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation39", *occ);
-  water->AddDecayChannel("QuadrupleIonisation39",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(2, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation40", *occ);
-  water->AddDecayChannel("QuadrupleIonisation40",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation41", *occ);
-  water->AddDecayChannel("QuadrupleIonisation41",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(1, 2);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation42", *occ);
-  water->AddDecayChannel("QuadrupleIonisation42",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  occ->RemoveElectron(3, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation43", *occ);
-  water->AddDecayChannel("QuadrupleIonisation43",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(2, 2);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation44", *occ);
-  water->AddDecayChannel("QuadrupleIonisation44",
-                         new G4MolecularDissociationChannel(*decCh1));
-
-  *occ = *(water->GetGroundStateElectronOccupancy());
-  occ->RemoveElectron(3, 2);
-  occ->RemoveElectron(4, 2);
-  water->NewConfigurationWithElectronOccupancy("QuadrupleIonisation45", *occ);
-  water->AddDecayChannel("QuadrupleIonisation45",
-                         new G4MolecularDissociationChannel(*decCh1));
+  // QuadrupleIonisation1, ..., QuadrupleIonisation45
+  DNAIonisationConfigurationTable::Register(water, 4, {decCh1});
 #endif // G4VERSION_NUMBER >= 1130
 
   //////////////////////////////////////////////////////////////////////////////
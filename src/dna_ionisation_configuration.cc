@@ -0,0 +1,228 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "dna_ionisation_configuration.hh"
+#include "G4ElectronOccupancy.hh"
+#include "G4MoleculeDefinition.hh"
+
+#include <string>
+
+namespace {
+
+using MI::DNAIonisationConfiguration;
+
+// {order, number, {holes in shell 1-5}}, in the order of registration
+constexpr DNAIonisationConfiguration kConfigurations[] = {
+  // single-ionisation
+  {1,  5, {0, 0, 0, 0, 1}},
+  {1,  4, {0, 0, 0, 1, 0}},
+  {1,  3, {0, 0, 1, 0, 0}},
+  {1,  2, {0, 1, 0, 0, 0}},
+  {1,  1, {1, 0, 0, 0, 0}},
+  // double-ionisation
+  {2, 15, {0, 0, 0, 0, 2}},
+  {2, 14, {0, 0, 0, 1, 1}},
+  {2, 13, {0, 0, 0, 2, 0}},
+  {2, 12, {0, 0, 1, 0, 1}},
+  {2, 11, {0, 0, 1, 1, 0}},
+  {2, 10, {0, 0, 2, 0, 0}},
+  {2,  9, {0, 1, 0, 0, 1}},
+  {2,  8, {0, 1, 0, 1, 0}},
+  {2,  7, {0, 1, 1, 0, 0}},
+  {2,  6, {0, 2, 0, 0, 0}},
+  {2,  5, {1, 0, 0, 0, 1}},
+  {2,  4, {1, 0, 0, 1, 0}},
+  {2,  3, {1, 0, 1, 0, 0}},
+  {2,  2, {1, 1, 0, 0, 0}},
+  {2,  1, {2, 0, 0, 0, 0}},
+  // triple-ionisation
+  {3, 30, {0, 0, 1, 1, 1}},
+  {3, 29, {0, 1, 0, 1, 1}},
+  {3, 28, {0, 1, 1, 0, 1}},
+  {3, 27, {0, 1, 1, 1, 0}},
+  {3, 26, {1, 0, 0, 1, 1}},
+  {3, 25, {1, 0, 1, 0, 1}},
+  {3, 24, {1, 0, 1, 1, 0}},
+  {3, 23, {1, 1, 0, 0, 1}},
+  {3, 22, {1, 1, 0, 1, 0}},
+  {3, 21, {1, 1, 1, 0, 0}},
+  {3, 20, {0, 0, 0, 1, 2}},
+  {3, 19, {0, 0, 1, 0, 2}},
+  {3, 18, {0, 1, 0, 0, 2}},
+  {3, 17, {1, 0, 0, 0, 2}},
+  {3, 16, {0, 0, 0, 2, 1}},
+  {3, 15, {0, 0, 1, 2, 0}},
+  {3, 14, {0, 1, 0, 2, 0}},
+  {3, 13, {1, 0, 0, 2, 0}},
+  {3, 12, {0, 0, 2, 0, 1}},
+  {3, 11, {0, 0, 2, 1, 0}},
+  {3, 10, {0, 1, 2, 0, 0}},
+  {3,  9, {1, 0, 2, 0, 0}},
+  {3,  8, {0, 2, 0, 0, 1}},
+  {3,  7, {0, 2, 0, 1, 0}},
+  {3,  6, {0, 2, 1, 0, 0}},
+  {3,  5, {1, 2, 0, 0, 0}},
+  {3,  4, {2, 0, 0, 0, 1}},
+  {3,  3, {2, 0, 0, 1, 0}},
+  {3,  2, {2, 0, 1, 0, 0}},
+  {3,  1, {2, 1, 0, 0, 0}},
+  // quadruple-ionisation
+  {4,  1, {1, 1, 1, 1, 0}},
+  {4,  2, {1, 1, 1, 0, 1}},
+  {4,  3, {1, 1, 0, 1, 1}},
+  {4,  4, {1, 0, 1, 1, 1}},
+  {4,  5, {0, 1, 1, 1, 1}},
+  {4,  6, {1, 1, 2, 0, 0}},
+  {4,  7, {1, 1, 0, 2, 0}},
+  {4,  8, {1, 1, 0, 0, 2}},
+  {4,  9, {1, 2, 1, 0, 0}},
+  {4, 10, {1, 0, 1, 2, 0}},
+  {4, 11, {1, 0, 1, 0, 2}},
+  {4, 12, {1, 2, 0, 1, 0}},
+  {4, 13, {1, 0, 2, 1, 0}},
+  {4, 14, {1, 0, 0, 1, 2}},
+  {4, 15, {1, 2, 0, 0, 1}},
+  {4, 16, {1, 0, 2, 0, 1}},
+  {4, 17, {1, 0, 0, 2, 1}},
+  {4, 18, {2, 1, 1, 0, 0}},
+  {4, 19, {0, 1, 1, 2, 0}},
+  {4, 20, {0, 1, 1, 0, 2}},
+  {4, 21, {2, 1, 0, 1, 0}},
+  {4, 22, {0, 1, 2, 1, 0}},
+  {4, 23, {0, 1, 0, 1, 2}},
+  {4, 24, {2, 1, 0, 0, 1}},
+  {4, 25, {0, 1, 2, 0, 1}},
+  {4, 26, {0, 1, 0, 2, 1}},
+  {4, 27, {2, 0, 1, 1, 0}},
+  {4, 28, {0, 2, 1, 1, 0}},
+  {4, 29, {0, 0, 1, 1, 2}},
+  {4, 30, {2, 0, 1, 0, 1}},
+  {4, 31, {0, 2, 1, 0, 1}},
+  {4, 32, {0, 0, 1, 2, 1}},
+  {4, 33, {2, 0, 0, 1, 1}},
+  {4, 34, {0, 2, 0, 1, 1}},
+  {4, 35, {0, 0, 2, 1, 1}},
+  {4, 36, {2, 2, 0, 0, 0}},
+  {4, 37, {2, 0, 2, 0, 0}},
+  {4, 38, {2, 0, 0, 2, 0}},
+  {4, 39, {2, 0, 0, 0, 2}},
+  {4, 40, {0, 2, 2, 0, 0}},
+  {4, 41, {0, 2, 0, 2, 0}},
+  {4, 42, {0, 2, 0, 0, 2}},
+  {4, 43, {0, 0, 2, 2, 0}},
+  {4, 44, {0, 0, 2, 0, 2}},
+  {4, 45, {0, 0, 0, 2, 2}},
+};
+
+constexpr std::size_t kNConfigurations =
+  sizeof(kConfigurations) / sizeof(kConfigurations[0]);
+
+static_assert(kNConfigurations == 95, "5 + 15 + 30 + 45 configurations");
+
+const char* const kPrefix[] = {
+  "SingleIonisation", "DoubleIonisation",
+  "TripleIonisation", "QuadrupleIonisation"
+};
+
+} // end of namespace
+
+namespace MI {
+
+std::array<const G4MolecularConfiguration*,
+           DNAIonisationConfigurationTable::kNPatterns>
+  DNAIonisationConfigurationTable::index_{};
+
+//------------------------------------------------------------------------------
+G4String DNAIonisationConfiguration::GetName() const
+{
+  return G4String(kPrefix[order - 1]) + std::to_string(number);
+}
+
+//------------------------------------------------------------------------------
+const DNAIonisationConfiguration* DNAIonisationConfigurationTable::begin()
+{
+  return kConfigurations;
+}
+
+//------------------------------------------------------------------------------
+const DNAIonisationConfiguration* DNAIonisationConfigurationTable::end()
+{
+  return kConfigurations + kNConfigurations;
+}
+
+//------------------------------------------------------------------------------
+std::size_t DNAIonisationConfigurationTable::size()
+{
+  return kNConfigurations;
+}
+
+//------------------------------------------------------------------------------
+void DNAIonisationConfigurationTable::Register(
+  G4MoleculeDefinition* water, int order,
+  std::initializer_list<G4MolecularDissociationChannel*> channels)
+{
+  const auto* ground = water->GetGroundStateElectronOccupancy();
+
+  for (const auto& c : kConfigurations) {
+    if (c.order != order) { continue; }
+
+    G4ElectronOccupancy occ(*ground);
+    for (int s = 0; s < kNShells; s++) {
+      if (c.holes[s] > 0) { occ.RemoveElectron(s, c.holes[s]); }
+    }
+
+    const auto name = c.GetName();
+    index_[c.GetCode()] = water->NewConfigurationWithElectronOccupancy(name, occ);
+    for (auto* channel : channels) {
+      water->AddDecayChannel(name, new G4MolecularDissociationChannel(*channel));
+    }
+  }
+
+  for (auto* channel : channels) { delete channel; }
+}
+
+//------------------------------------------------------------------------------
+const G4MolecularConfiguration*
+DNAIonisationConfigurationTable::Find(const G4ElectronOccupancy& occ)
+{
+  // NOTE(SO): ionised states have no electron above the ground state
+  // orbitals, the holes are counted against a full water molecule (2 e-)
+  for (G4int s = kNShells; s < occ.GetSizeOfOrbit(); s++) {
+    if (occ.GetOccupancy(s) != 0) { return nullptr; }
+  }
+  int code = 0;
+  int order = 0;
+  for (int s = kNShells - 1; s >= 0; s--) {
+    int holes = 2 - occ.GetOccupancy(s);
+    if (holes < 0 || holes > 2) { return nullptr; }
+    code = 3 * code + holes;
+    order += holes;
+  }
+  return Find(order, code);
+}
+
+} // end of namespace MI
@@ -0,0 +1,184 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "dna_molecular_dissociation.hh"
+#include "G4H2O.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4MolecularDissociationChannel.hh"
+#include "G4Molecule.hh"
+#include "G4MoleculeTable.hh"
+#include "G4VMolecularDecayDisplacer.hh"
+#include "Randomize.hh"
+
+#include <algorithm>
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+const DNADissociationDispatch* DNADissociationDispatch::Instance()
+{
+  static const DNADissociationDispatch instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+// Vose's alias method: n equal bins, each split between at most two channels
+void DNADissociationDispatch::BuildAliasTable(
+  const std::vector<double>& weights, AliasTable& table)
+{
+  const int n = static_cast<int>(weights.size());
+  double sum = 0.;
+  for (auto w : weights) { sum += w; }
+
+  table.prob.assign(n, 1.);
+  table.alias.resize(n);
+  for (int i = 0; i < n; i++) { table.alias[i] = i; }
+  if (sum <= 0.) { return; }
+
+  std::vector<double> scaled(n);
+  std::vector<int> small, large;
+  for (int i = 0; i < n; i++) {
+    scaled[i] = weights[i] * n / sum;
+    (scaled[i] < 1. ? small : large).push_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    int s = small.back();
+    small.pop_back();
+    int l = large.back();
+    table.prob[s] = scaled[s];
+    table.alias[s] = l;
+    scaled[l] -= 1. - scaled[s];
+    if (scaled[l] < 1.) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // the remaining bins are full up to rounding errors
+  for (auto i : small) { table.prob[i] = 1.; }
+  for (auto i : large) { table.prob[i] = 1.; }
+}
+
+//------------------------------------------------------------------------------
+DNADissociationDispatch::DNADissociationDispatch()
+{
+  auto* water = G4H2O::Definition();
+
+  auto itr = G4MoleculeTable::Instance()->GetConfigurationIterator();
+  itr.reset();
+  while (itr()) {
+    auto* conf = itr.value();
+    if (conf->GetDefinition() != water) { continue; }
+
+    const auto* channels = water->GetDecayChannels(conf);
+    if (channels == nullptr || channels->empty()) { continue; }
+
+    const auto id = static_cast<std::size_t>(conf->GetMoleculeID());
+    if (tables_.size() <= id) { tables_.resize(id + 1); }
+
+    // NOTE(SO): same probabilities as the linear search of Geant4
+    auto& table = tables_[id];
+    std::vector<double> weights;
+    double left = 1.;
+    for (auto* channel : *channels) {
+      auto w = std::clamp(channel->GetProbability(), 0., left);
+      left -= w;
+      table.channels.push_back(channel);
+      weights.push_back(w);
+    }
+    weights.back() += left;
+    BuildAliasTable(weights, table);
+  }
+}
+
+//------------------------------------------------------------------------------
+DNADissociationDispatch::Channel* DNADissociationDispatch::Sample(
+  const G4MolecularConfiguration* conf, double u) const
+{
+  const auto id = static_cast<std::size_t>(conf->GetMoleculeID());
+  if (id >= tables_.size() || tables_[id].channels.empty()) { return nullptr; }
+
+  // the bin is the integer part of u * n, the fraction selects the alias
+  const auto& table = tables_[id];
+  const int n = static_cast<int>(table.channels.size());
+  const double x = u * n;
+  const int bin = std::min(static_cast<int>(x), n - 1);
+  return table.channels[x - bin < table.prob[bin] ? bin : table.alias[bin]];
+}
+
+//==============================================================================
+DNAMolecularDissociation::DNAMolecularDissociation(const G4String& name)
+  : G4DNAMolecularDissociation(name, fDecay)
+{}
+
+//------------------------------------------------------------------------------
+G4VParticleChange* DNAMolecularDissociation::AtRestDoIt(const G4Track& track,
+                                                        const G4Step& step)
+{
+  return Dissociate(track, step);
+}
+
+//------------------------------------------------------------------------------
+G4VParticleChange* DNAMolecularDissociation::PostStepDoIt(const G4Track& track,
+                                                          const G4Step& step)
+{
+  return Dissociate(track, step);
+}
+
+//------------------------------------------------------------------------------
+G4VParticleChange* DNAMolecularDissociation::Dissociate(const G4Track& track,
+                                                        const G4Step& step)
+{
+  auto* molecule = GetMolecule(track);
+  auto* channel = DNADissociationDispatch::Instance()->Sample(
+    molecule->GetMolecularConfiguration(), G4UniformRand());
+  // not a water configuration with channels: the Geant4 decay reports it
+  if (channel == nullptr) { return DecayIt(track, step); }
+
+  aParticleChange.Initialize(track);
+  aParticleChange.ProposeTrackStatus(fStopAndKill);
+
+  const auto energy = channel->GetEnergy();
+  if (energy > 0.) { aParticleChange.ProposeLocalEnergyDeposit(energy); }
+
+  const auto nproducts = channel->GetNbProducts();
+  if (nproducts <= 0) { return &aParticleChange; }
+
+  auto* displacer = GetDisplacer(G4H2O::Definition());
+  const auto displacements = displacer->GetProductsDisplacement(channel);
+
+  aParticleChange.SetNumberOfSecondaries(nproducts);
+  for (G4int i = 0; i < nproducts; i++) {
+    auto* product = new G4Molecule(channel->GetProduct(i));
+    auto* secondary = product->BuildTrack(
+      track.GetGlobalTime(), track.GetPosition() + displacements[i]);
+    secondary->SetTrackStatus(fAlive);
+    aParticleChange.G4VParticleChange::AddSecondary(secondary);
+  }
+  return &aParticleChange;
+}
+
+} // end of namespace MI
@@ -0,0 +1,201 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "dna_scavenger.hh"
+#include "G4DNAMolecularReactionTable.hh"
+#include "G4MoleculeTable.hh"
+#include "G4SystemOfUnits.hh"
+
+#if G4VERSION_NUMBER >= 1120
+#include "G4Box.hh"
+#include "G4DNABoundingBox.hh"
+#include "G4DNAScavengerMaterial.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Navigator.hh"
+#include "G4Scheduler.hh"
+#include "G4TransportationManager.hh"
+#include "G4VPhysicalVolume.hh"
+#endif
+
+namespace {
+
+// conversion factor of second-order rate constants to 1/(M s)
+const double kRateUnit = 1e-3 * m3 / (mole * s);
+
+//------------------------------------------------------------------------------
+const G4MolecularConfiguration* FindConfiguration(const G4String& name)
+{
+  auto* conf = G4MoleculeTable::Instance()->GetConfiguration(name, false);
+  if (conf == nullptr) {
+    G4ExceptionDescription msg;
+    msg << "Molecular configuration " << name << " is not defined "
+        << "by the chemistry constructor.";
+    G4Exception("MI::DNAScavengerTable", "MI_SCAVENGER_001",
+                FatalException, msg);
+  }
+  return conf;
+}
+
+//------------------------------------------------------------------------------
+// reactant + scavenger -> products, pseudo-first-order (type 6)
+G4DNAMolecularReactionData* NewReaction(const MI::DNAScavenger& sc)
+{
+  auto* data = new G4DNAMolecularReactionData(
+    sc.rate_constant * kRateUnit,
+    FindConfiguration(sc.reactant), FindConfiguration(sc.scavenger));
+  for (const auto& product : sc.products) {
+    data->AddProduct(FindConfiguration(product));
+  }
+  data->SetReactionType(6);
+  return data;
+}
+
+} // end of namespace
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+DNAScavengerTable* DNAScavengerTable::Instance()
+{
+  static DNAScavengerTable instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+void DNAScavengerTable::Add(const DNAScavenger& scavenger)
+{
+  scavengers_.push_back(scavenger);
+}
+
+//------------------------------------------------------------------------------
+double DNAScavengerTable::GetConcentration(
+  const G4MolecularConfiguration* scavenger) const
+{
+  for (const auto& sc : scavengers_) {
+    auto* conf = G4MoleculeTable::Instance()->GetConfiguration(sc.scavenger, false);
+    if (conf == scavenger) { return sc.concentration; }
+  }
+  return 0.;
+}
+
+//------------------------------------------------------------------------------
+void DNAScavengerTable::ConstructReactions(G4DNAMolecularReactionTable* table) const
+{
+  for (const auto& sc : scavengers_) {
+    table->SetReaction(NewReaction(sc));
+  }
+}
+
+//------------------------------------------------------------------------------
+void DNAScavengerTable::RestoreReactions() const
+{
+  if (IsEmpty()) { return; }
+
+  // NOTE(SO): /chem/reaction/UI resets the reaction table after the
+  // chemistry constructor, the scavenger reactions are added back at the
+  // beginning of each run. The table is a process-wide singleton written
+  // without lock, the workers must not run yet.
+  auto* table = G4DNAMolecularReactionTable::Instance();
+  const auto& reactions = table->GetAllReactionData();
+  bool restored = false;
+  for (const auto& sc : scavengers_) {
+    auto it = reactions.find(FindConfiguration(sc.reactant));
+    if (it != reactions.end()
+        && it->second.count(FindConfiguration(sc.scavenger)) > 0) { continue; }
+
+    table->SetReaction(NewReaction(sc));
+    restored = true;
+  }
+  static G4bool warned = false;
+  if (restored && !warned) {
+    warned = true;
+    G4Exception("MI::DNAScavengerTable::RestoreReactions",
+                "MI_SCAVENGER_004", JustWarning,
+                "The scavenger reactions were removed from the reaction table "
+                "(e.g. by /chem/reaction/UI), they are added back.");
+  }
+}
+
+//------------------------------------------------------------------------------
+void DNAScavengerTable::InstallScavengerMaterial() const
+{
+  if (IsEmpty()) { return; }
+
+#if G4VERSION_NUMBER >= 1120
+  auto* scheduler = G4Scheduler::Instance();
+  if (scheduler->GetScavengerMaterial() != nullptr) { return; }
+
+  // NOTE(SO): the scavenger material keeps a pointer to the world,
+  // it lives as long as the thread
+  static G4ThreadLocal DNAChemistryWorld* world = nullptr;
+  if (world == nullptr) {
+    world = new DNAChemistryWorld();
+    world->ConstructChemistryBoundary();
+    world->ConstructChemistryComponents();
+  }
+
+  auto material = std::make_unique<G4DNAScavengerMaterial>(world);
+  material->Initialize();
+  scheduler->SetScavengerMaterial(std::move(material));
+#else
+  G4Exception("MI::DNAScavengerTable::InstallScavengerMaterial",
+              "MI_SCAVENGER_002", JustWarning,
+              "Scavengers require Geant4 11.2 or later, they are ignored.");
+#endif
+}
+
+#if G4VERSION_NUMBER >= 1120
+//------------------------------------------------------------------------------
+void DNAChemistryWorld::ConstructChemistryBoundary()
+{
+  auto* world = G4TransportationManager::GetTransportationManager()
+                  ->GetNavigatorForTracking()->GetWorldVolume();
+  auto* box = dynamic_cast<G4Box*>(world->GetLogicalVolume()->GetSolid());
+  if (box == nullptr) {
+    G4Exception("MI::DNAChemistryWorld::ConstructChemistryBoundary",
+                "MI_SCAVENGER_003", FatalException,
+                "The world volume must be a box.");
+    return;
+  }
+  const double x = box->GetXHalfLength();
+  const double y = box->GetYHalfLength();
+  const double z = box->GetZHalfLength();
+  fpChemistryBoundary =
+    std::make_unique<G4DNABoundingBox>(G4DNABoundingBox{x, -x, y, -y, z, -z});
+}
+
+//------------------------------------------------------------------------------
+void DNAChemistryWorld::ConstructChemistryComponents()
+{
+  for (const auto& sc : DNAScavengerTable::Instance()->GetScavengers()) {
+    fpChemicalComponent[FindConfiguration(sc.scavenger)] =
+      sc.concentration * mole / liter;
+  }
+}
+#endif
+
+} // end of namespace MI
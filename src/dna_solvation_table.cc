@@ -0,0 +1,215 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "dna_solvation_table.hh"
+#include "G4EmParameters.hh"
+#include "G4RandomDirection.hh"
+#include "G4SystemOfUnits.hh"
+#include "Randomize.hh"
+#include "CLHEP/Random/MixMaxRng.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <mutex>
+
+namespace MI {
+
+namespace {
+
+// sub-excitation electrons are thermalised below ~10 eV
+constexpr G4double kEmin = 0.01 * eV;
+constexpr G4double kEmax = 20. * eV;
+
+} // end of namespace
+
+//------------------------------------------------------------------------------
+DNASolvationTable* DNASolvationTable::Instance()
+{
+  static DNASolvationTable instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+G4double DNASolvationTable::GetEnergy(G4int index) const
+{
+  return std::exp(log_emin_ + index * dlog_e_);
+}
+
+//------------------------------------------------------------------------------
+void DNASolvationTable::SampleModel(G4double energy,
+                                    G4ThreeVector& displacement) const
+{
+  switch (model_) {
+    case fRitchie1994:
+      DNA::Penetration::Ritchie1994::GetPenetration(energy, displacement);
+      break;
+    case fTerrisol1990:
+      DNA::Penetration::Terrisol1990::GetPenetration(energy, displacement);
+      break;
+    default:
+      DNA::Penetration::Meesungnoen2002::GetPenetration(energy, displacement);
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+void DNASolvationTable::Build()
+{
+  static std::once_flag built;
+  std::call_once(built, [this]() {
+    model_ = G4EmParameters::Instance()->DNAeSolvationSubType();
+    switch (model_) {
+      case fRitchie1994: model_name_ = "Ritchie1994"; break;
+      case fTerrisol1990: model_name_ = "Terrisol1990"; break;
+      case fMeesungnoen2002: model_name_ = "Meesungnoen2002"; break;
+      default:
+        model_ = fMeesungnoen2002;
+        model_name_ = "Meesungnoen2002";
+        G4Exception("MI::DNASolvationTable::Build", "MI_SOLVATION_001",
+                    JustWarning,
+                    "The solvation model is not tabulated, "
+                    "Meesungnoen2002 is used.");
+        break;
+    }
+
+    log_emin_ = std::log(kEmin);
+    dlog_e_ = (std::log(kEmax) - log_emin_) / (kNEnergies - 1);
+
+    // calibrate with a private engine, the event engine is restored
+    auto* engine = G4Random::getTheEngine();
+    CLHEP::MixMaxRng calibration_engine(20021994);
+    G4Random::setTheEngine(&calibration_engine);
+
+    quantiles_.resize(kNEnergies * (kNQuantiles + 1));
+    rmean_.resize(kNEnergies);
+    std::vector<G4double> distances(kNCalibrations);
+    G4ThreeVector displacement;
+    for (G4int i = 0; i < kNEnergies; i++) {
+      G4double sum = 0.;
+      for (auto& d : distances) {
+        SampleModel(GetEnergy(i), displacement);
+        d = displacement.mag();
+        sum += d;
+      }
+      std::sort(distances.begin(), distances.end());
+      rmean_[i] = sum / kNCalibrations;
+      auto* q = &quantiles_[i * (kNQuantiles + 1)];
+      for (G4int k = 0; k <= kNQuantiles; k++) {
+        q[k] = distances[(std::size_t)k * (kNCalibrations - 1) / kNQuantiles];
+      }
+    }
+
+    G4Random::setTheEngine(engine);
+  });
+}
+
+//------------------------------------------------------------------------------
+G4double DNASolvationTable::SampleDistance(G4double energy) const
+{
+  // stochastic interpolation between the two energy grid points
+  G4double x = (std::log(std::max(energy, kEmin)) - log_emin_) / dlog_e_;
+  x = std::min(x, G4double(kNEnergies - 1));
+  auto i = static_cast<G4int>(x);
+  if (i < kNEnergies - 1 && G4UniformRand() < x - i) { i++; }
+
+  const auto* q = &quantiles_[i * (kNQuantiles + 1)];
+  const G4double u = G4UniformRand() * kNQuantiles;
+  const auto k = std::min(static_cast<G4int>(u), kNQuantiles - 1);
+  return q[k] + (u - k) * (q[k + 1] - q[k]);
+}
+
+//------------------------------------------------------------------------------
+void DNASolvationTable::GetPenetration(G4double energy,
+                                       G4ThreeVector& displacement) const
+{
+  displacement = SampleDistance(energy) * G4RandomDirection();
+}
+
+//------------------------------------------------------------------------------
+G4double DNASolvationTable::GetRmean(G4double energy) const
+{
+  G4double x = (std::log(std::max(energy, kEmin)) - log_emin_) / dlog_e_;
+  x = std::min(x, G4double(kNEnergies - 1));
+  auto i = std::min(static_cast<G4int>(x), kNEnergies - 2);
+  return rmean_[i] + (x - i) * (rmean_[i + 1] - rmean_[i]);
+}
+
+//------------------------------------------------------------------------------
+void DNASolvationTable::Validate(std::ostream& os, G4int nsamples) const
+{
+  if (!IsBuilt()) { return; }
+
+  os << "Solvation table (" << model_name_ << ") vs model, "
+     << nsamples << " samples:" << std::endl;
+  os << std::setw(12) << "E (eV)" << std::setw(14) << "mean (nm)"
+     << std::setw(14) << "model" << std::setw(14) << "RMS (nm)"
+     << std::setw(14) << "model" << std::setw(12) << "KS" << std::endl;
+
+  auto* engine = G4Random::getTheEngine();
+  CLHEP::MixMaxRng validation_engine(19902002);
+  G4Random::setTheEngine(&validation_engine);
+
+  std::vector<G4double> table(nsamples), model(nsamples);
+  G4ThreeVector displacement;
+  for (G4int i = 0; i < kNEnergies; i += 7) {
+    const G4double energy = GetEnergy(i);
+    for (G4int n = 0; n < nsamples; n++) {
+      table[n] = SampleDistance(energy);
+      SampleModel(energy, displacement);
+      model[n] = displacement.mag();
+    }
+    std::sort(table.begin(), table.end());
+    std::sort(model.begin(), model.end());
+
+    G4double mean[2] = {0., 0.}, rms[2] = {0., 0.};
+    for (G4int n = 0; n < nsamples; n++) {
+      mean[0] += table[n];
+      mean[1] += model[n];
+      rms[0] += table[n] * table[n];
+      rms[1] += model[n] * model[n];
+    }
+    // Kolmogorov distance of the two empirical distributions
+    G4double ks = 0.;
+    std::size_t j = 0;
+    for (std::size_t n = 0; n < table.size(); n++) {
+      while (j < model.size() && model[j] <= table[n]) { j++; }
+      ks = std::max(ks, std::abs(G4double(n + 1) - G4double(j)) / nsamples);
+    }
+
+    os << std::setw(12) << energy / eV
+       << std::setw(14) << mean[0] / nsamples / nm
+       << std::setw(14) << mean[1] / nsamples / nm
+       << std::setw(14) << std::sqrt(rms[0] / nsamples) / nm
+       << std::setw(14) << std::sqrt(rms[1] / nsamples) / nm
+       << std::setw(12) << ks << std::endl;
+  }
+
+  G4Random::setTheEngine(engine);
+}
+
+} // end of namespace MI
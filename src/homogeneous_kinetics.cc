@@ -0,0 +1,326 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "homogeneous_kinetics.hh"
+#include "dna_scavenger.hh"
+#include "G4DNAMolecularReactionTable.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4H2O.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+
+namespace {
+
+// conversion factor of second-order rate constants to 1/(M s)
+const double kRateUnit = 1e-3 * m3 / (mole * s);
+
+// gamma of the ROS2 scheme, 1 + 1/sqrt(2)
+const double kGamma = 1. + 1. / std::sqrt(2.);
+
+const int kMaxSteps = 100000;
+
+//------------------------------------------------------------------------------
+bool IsSolvent(const G4MolecularConfiguration* species)
+{
+  return species != nullptr && species->GetDefinition() == G4H2O::Definition();
+}
+
+//------------------------------------------------------------------------------
+// once per reaction for all the threads and runs
+void WarnSkipped(const G4DNAMolecularReactionData* data)
+{
+  static std::mutex mutex;
+  static std::set<std::string> warned;
+
+  std::ostringstream reaction;
+  reaction << data->GetReactant1()->GetName() << " + "
+           << data->GetReactant2()->GetName();
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!warned.insert(reaction.str()).second) { return; }
+
+  G4ExceptionDescription msg;
+  msg << "The reaction " << reaction.str() << " (type "
+      << data->GetReactionType() << ") has no rate in the homogeneous "
+      << "kinetics and is skipped.";
+  G4Exception("MI::HomogeneousKinetics::Initialize", "MI_KINETICS_002",
+              JustWarning, msg);
+}
+
+//------------------------------------------------------------------------------
+bool LUDecompose(std::vector<double>& a, std::vector<int>& piv, std::size_t n)
+{
+  for (std::size_t k = 0; k < n; k++) {
+    std::size_t p = k;
+    double amax = std::abs(a[k * n + k]);
+    for (std::size_t i = k + 1; i < n; i++) {
+      if (std::abs(a[i * n + k]) > amax) {
+        amax = std::abs(a[i * n + k]);
+        p = i;
+      }
+    }
+    if (amax == 0.) { return false; }
+    piv[k] = static_cast<int>(p);
+    if (p != k) {
+      for (std::size_t j = 0; j < n; j++) { std::swap(a[k * n + j], a[p * n + j]); }
+    }
+    for (std::size_t i = k + 1; i < n; i++) {
+      a[i * n + k] /= a[k * n + k];
+      const double f = a[i * n + k];
+      for (std::size_t j = k + 1; j < n; j++) { a[i * n + j] -= f * a[k * n + j]; }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void LUSolve(const std::vector<double>& a, const std::vector<int>& piv,
+             std::vector<double>& b, std::size_t n)
+{
+  for (std::size_t k = 0; k < n; k++) {
+    if (piv[k] != static_cast<int>(k)) { std::swap(b[k], b[piv[k]]); }
+  }
+  for (std::size_t i = 1; i < n; i++) {
+    for (std::size_t j = 0; j < i; j++) { b[i] -= a[i * n + j] * b[j]; }
+  }
+  for (std::size_t i = n; i-- > 0;) {
+    for (std::size_t j = i + 1; j < n; j++) { b[i] -= a[i * n + j] * b[j]; }
+    b[i] /= a[i * n + i];
+  }
+}
+
+} // end of namespace
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+void HomogeneousKinetics::Initialize()
+{
+  species_.clear();
+  index_.clear();
+  reactions_.clear();
+
+  auto* table = G4DNAMolecularReactionTable::Instance();
+
+  // the reaction data map is symmetric, each reaction appears twice
+  std::set<const G4DNAMolecularReactionData*> done;
+  for (const auto& it1 : table->GetAllReactionData()) {
+    for (const auto& it2 : it1.second) {
+      const auto* data = it2.second;
+      if (data == nullptr || !done.insert(data).second) { continue; }
+
+      Reaction reaction;
+      reaction.reactant2 = -1;
+      if (IsSolvent(data->GetReactant1()) || IsSolvent(data->GetReactant2())) {
+        // NOTE(SO): the solvent reactions hold their first-order rate, as
+        // sampled by the IRT (e.g. e_aq + H2O, H3O+ / OH- equilibria)
+        auto* reactant = IsSolvent(data->GetReactant1())
+          ? data->GetReactant2() : data->GetReactant1();
+        reaction.reactant1 = AddSpecies(reactant);
+        reaction.k = data->GetObservedReactionRateConstant() * s;
+      }
+      else if (data->GetReactionType() == 6) {
+        // pseudo-first-order scavenging, k' = k [scavenger]
+        reaction.reactant1 = AddSpecies(data->GetReactant1());
+        reaction.k = data->GetObservedReactionRateConstant() / kRateUnit
+          * MI::DNAScavengerTable::Instance()
+              ->GetConcentration(data->GetReactant2());
+      }
+      else {
+        reaction.reactant1 = AddSpecies(data->GetReactant1());
+        reaction.reactant2 = AddSpecies(data->GetReactant2());
+        reaction.k = data->GetObservedReactionRateConstant() / kRateUnit;
+        if (reaction.reactant2 < 0) { reaction.reactant1 = -1; }
+      }
+      if (reaction.reactant1 < 0 || reaction.k <= 0.) {
+        WarnSkipped(data);
+        continue;
+      }
+      for (G4int i = 0; i < data->GetNbProducts(); i++) {
+        int idx = AddSpecies(data->GetProduct(i));
+        if (idx >= 0) { reaction.products.push_back(idx); }
+      }
+      reactions_.push_back(reaction);
+    }
+  }
+
+  initialized_ = true;
+}
+
+//------------------------------------------------------------------------------
+int HomogeneousKinetics::AddSpecies(Species* species)
+{
+  // water is the solvent, it is not part of the kinetics
+  if (species == nullptr || IsSolvent(species)) { return -1; }
+  auto itr = index_.find(species);
+  if (itr != index_.end()) { return itr->second; }
+
+  int idx = static_cast<int>(species_.size());
+  species_.push_back(species);
+  index_[species] = idx;
+  return idx;
+}
+
+//------------------------------------------------------------------------------
+int HomogeneousKinetics::GetIndex(Species* species) const
+{
+  auto itr = index_.find(species);
+  return itr != index_.end() ? itr->second : -1;
+}
+
+//------------------------------------------------------------------------------
+// Mass action kinetics: r = k [A][B], for identical reactants r = k [A]^2
+// and two molecules of A are consumed per reaction. First-order reactions
+// (scavenging) give r = k [A].
+void HomogeneousKinetics::ComputeDerivatives(const std::vector<double>& c,
+                                             std::vector<double>& dcdt) const
+{
+  std::fill(dcdt.begin(), dcdt.end(), 0.);
+  for (const auto& r : reactions_) {
+    if (r.reactant2 < 0) {
+      double rate = r.k * c[r.reactant1];
+      dcdt[r.reactant1] -= rate;
+      for (auto p : r.products) { dcdt[p] += rate; }
+      continue;
+    }
+    double rate = r.k * c[r.reactant1] * c[r.reactant2];
+    dcdt[r.reactant1] -= rate;
+    dcdt[r.reactant2] -= rate;
+    for (auto p : r.products) { dcdt[p] += rate; }
+  }
+}
+
+//------------------------------------------------------------------------------
+void HomogeneousKinetics::ComputeJacobian(const std::vector<double>& c,
+                                          std::vector<double>& jac) const
+{
+  const std::size_t n = species_.size();
+  std::fill(jac.begin(), jac.end(), 0.);
+
+  auto add_column = [&](const Reaction& r, int col, double drate) {
+    jac[r.reactant1 * n + col] -= drate;
+    if (r.reactant2 >= 0) { jac[r.reactant2 * n + col] -= drate; }
+    for (auto p : r.products) { jac[p * n + col] += drate; }
+  };
+
+  for (const auto& r : reactions_) {
+    if (r.reactant2 < 0) {
+      add_column(r, r.reactant1, r.k);
+      continue;
+    }
+    add_column(r, r.reactant1, r.k * c[r.reactant2]);
+    add_column(r, r.reactant2, r.k * c[r.reactant1]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// One ROS2 step (Verwer et al., SIAM J. Sci. Comput. 20 (1999) 1456)
+//   W k1 = F(y)
+//   W k2 = F(y + h k1) - 2 k1
+//   y1 = y + 3/2 h k1 + 1/2 h k2,   W = I - gamma h J
+// The difference with the embedded Euler solution gives the error estimate.
+bool HomogeneousKinetics::Step(std::vector<double>& c, double h,
+                               double& err) const
+{
+  const std::size_t n = species_.size();
+  std::vector<double> w(n * n), k1(n), k2(n), y1(n);
+  std::vector<int> piv(n);
+
+  ComputeJacobian(c, w);
+  for (std::size_t i = 0; i < n * n; i++) { w[i] *= -kGamma * h; }
+  for (std::size_t i = 0; i < n; i++) { w[i * n + i] += 1.; }
+  if (!LUDecompose(w, piv, n)) { return false; }
+
+  ComputeDerivatives(c, k1);
+  LUSolve(w, piv, k1, n);
+
+  for (std::size_t i = 0; i < n; i++) { y1[i] = c[i] + h * k1[i]; }
+  ComputeDerivatives(y1, k2);
+  for (std::size_t i = 0; i < n; i++) { k2[i] -= 2. * k1[i]; }
+  LUSolve(w, piv, k2, n);
+
+  err = 0.;
+  for (std::size_t i = 0; i < n; i++) {
+    double cnew = c[i] + 1.5 * h * k1[i] + 0.5 * h * k2[i];
+    double scale = atol_ + rtol_ * std::max(std::abs(c[i]), std::abs(cnew));
+    err = std::max(err, std::abs(0.5 * h * (k1[i] + k2[i])) / scale);
+    y1[i] = cnew;
+  }
+  if (!std::isfinite(err)) { return false; }
+
+  for (std::size_t i = 0; i < n; i++) { c[i] = std::max(y1[i], 0.); }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void HomogeneousKinetics::Solve(const std::vector<double>& conc0, double t0,
+                                const std::vector<double>& times,
+                                std::vector<std::vector<double>>& result) const
+{
+  result.clear();
+  std::vector<double> c = conc0;
+  c.resize(species_.size(), 0.);
+
+  double t = t0 / s;
+  double h = 1.e-3 * std::max(t, 1.e-12);
+  int nsteps = 0;
+  bool warned = false;
+
+  for (auto time : times) {
+    const double tend = time / s;
+    while (tend - t > 1.e-12 * tend && nsteps < kMaxSteps) {
+      const double hh = std::min(h, tend - t);
+      std::vector<double> trial = c;
+      double err = 0.;
+      ++nsteps;
+      if (!Step(trial, hh, err) || err > 1.) {
+        h = hh * (err > 1. ? std::max(0.2, 0.9 / std::sqrt(err)) : 0.2);
+        continue;
+      }
+      t += hh;
+      c.swap(trial);
+      h = hh * std::min(5., std::max(0.2, 0.9 / std::sqrt(std::max(err, 1.e-10))));
+    }
+    if (!warned && nsteps >= kMaxSteps && tend - t > 1.e-12 * tend) {
+      warned = true;
+      G4ExceptionDescription msg;
+      msg << "The integration stopped after " << kMaxSteps << " steps at "
+          << t << " s (requested " << tend << " s), the concentrations "
+          << "of this and the later times are those at " << t << " s.";
+      G4Exception("MI::HomogeneousKinetics::Solve", "MI_KINETICS_001",
+                  JustWarning, msg);
+    }
+    result.push_back(c);
+  }
+}
+
+} // end of namespace MI
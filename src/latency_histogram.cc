@@ -0,0 +1,63 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "latency_histogram.hh"
+
+#include <algorithm>
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+void LatencyHistogram::Merge(const LatencyHistogram& other)
+{
+  for (int i = 0; i < kNBins; i++) { bins_[i] += other.bins_[i]; }
+  entries_ += other.entries_;
+  sum_ += other.sum_;
+  max_ = std::max(max_, other.max_);
+}
+
+//------------------------------------------------------------------------------
+double LatencyHistogram::GetQuantile(double q) const
+{
+  if (entries_ == 0) { return 0.; }
+  const double target = std::clamp(q, 0., 1.) * entries_;
+
+  double cumulative = 0.;
+  for (int i = 0; i < kNBins; i++) {
+    if (bins_[i] == 0) { continue; }
+    if (cumulative + bins_[i] >= target) {
+      const double fraction = (target - cumulative) / bins_[i];
+      const double value =
+        kMin * std::pow(10., (i + fraction) / kBinsPerDecade);
+      return std::min(value, max_);
+    }
+    cumulative += bins_[i];
+  }
+  return max_;
+}
+
+} // end of namespace MI
@@ -0,0 +1,328 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "memory_tracker.hh"
+#include "globals.hh"
+#include "G4Threading.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// NOTE(SO): the replacement of operator new / delete costs a few atomic
+// operations per allocation, it is only built with -DCHEM6_MEMORY_TRACKER=ON
+#if defined(CHEM6_MEMORY_TRACKER) && defined(__GLIBC__)
+#include <malloc.h>
+#define MI_USABLE_SIZE(p) malloc_usable_size(p)
+#elif defined(CHEM6_MEMORY_TRACKER) && defined(__APPLE__)
+#include <malloc/malloc.h>
+#define MI_USABLE_SIZE(p) malloc_size(p)
+#endif
+
+namespace {
+
+//------------------------------------------------------------------------------
+// counters of a thread, written by the thread only (the last slot is shared
+// when there are more threads)
+struct alignas(64) Slot {
+  std::atomic<std::int64_t> allocated;
+  std::atomic<std::int64_t> allocations;
+  std::atomic<std::int64_t> live;
+  std::atomic<std::int64_t> peak;
+  std::int64_t allocated_at_reset;
+  std::int64_t allocations_at_reset;
+  std::atomic<long> live_species;  // in the event in flight
+  int thread_id;
+  bool registered;
+};
+
+const int kMaxSlots = 256;
+
+// zero-initialized before any allocation
+Slot slots[kMaxSlots];
+std::atomic<int> nslots{0};
+
+thread_local int slot_index = -1;
+thread_local long peak_species = 0;
+
+const double kMB = 1024. * 1024.;
+
+//------------------------------------------------------------------------------
+Slot& GetSlot()
+{
+  if (slot_index < 0) {
+    int index = nslots.fetch_add(1, std::memory_order_relaxed);
+    slot_index = index < kMaxSlots ? index : kMaxSlots - 1;
+  }
+  return slots[slot_index];
+}
+
+#ifdef MI_USABLE_SIZE
+//------------------------------------------------------------------------------
+void CountAllocation(std::size_t size)
+{
+  auto& slot = GetSlot();
+  const auto bytes = static_cast<std::int64_t>(size);
+  slot.allocated.fetch_add(bytes, std::memory_order_relaxed);
+  slot.allocations.fetch_add(1, std::memory_order_relaxed);
+  auto live = slot.live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  if (live > slot.peak.load(std::memory_order_relaxed)) {
+    slot.peak.store(live, std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+void CountFree(std::size_t size)
+{
+  GetSlot().live.fetch_sub(static_cast<std::int64_t>(size),
+                           std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void* Allocate(std::size_t size) noexcept
+{
+  if (size == 0) { size = 1; }
+  void* p;
+  while ((p = std::malloc(size)) == nullptr) {
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) { return nullptr; }
+    handler();
+  }
+  CountAllocation(MI_USABLE_SIZE(p));
+  return p;
+}
+
+//------------------------------------------------------------------------------
+void Free(void* p) noexcept
+{
+  if (p == nullptr) { return; }
+  CountFree(MI_USABLE_SIZE(p));
+  std::free(p);
+}
+#endif
+
+} // end of namespace
+
+#ifdef MI_USABLE_SIZE
+//------------------------------------------------------------------------------
+// replacement of the global allocation functions (the aligned ones are left
+// to the standard library)
+void* operator new(std::size_t size)
+{
+  void* p = Allocate(size);
+  if (p == nullptr) { throw std::bad_alloc(); }
+  return p;
+}
+
+void* operator new[](std::size_t size)
+{
+  void* p = Allocate(size);
+  if (p == nullptr) { throw std::bad_alloc(); }
+  return p;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return Allocate(size);
+}
+
+void operator delete(void* p) noexcept { Free(p); }
+void operator delete[](void* p) noexcept { Free(p); }
+void operator delete(void* p, std::size_t) noexcept { Free(p); }
+void operator delete[](void* p, std::size_t) noexcept { Free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { Free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { Free(p); }
+#endif
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+MemoryTracker* MemoryTracker::Instance()
+{
+  static MemoryTracker instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+bool MemoryTracker::IsAvailable()
+{
+#ifdef MI_USABLE_SIZE
+  return true;
+#else
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::RegisterThread()
+{
+  auto& slot = GetSlot();
+  slot.thread_id = G4Threading::G4GetThreadId();
+  slot.registered = true;
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::ResetRun()
+{
+  const int n = std::min(nslots.load(), kMaxSlots);
+  for (int i = 0; i < n; i++) {
+    auto& slot = slots[i];
+    slot.allocated_at_reset = slot.allocated.load(std::memory_order_relaxed);
+    slot.allocations_at_reset = slot.allocations.load(std::memory_order_relaxed);
+    slot.peak.store(slot.live.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<MemoryTracker::ThreadStats> MemoryTracker::GetThreadStats() const
+{
+  std::vector<ThreadStats> stats;
+  const int n = std::min(nslots.load(), kMaxSlots);
+  for (int i = 0; i < n; i++) {
+    const auto& slot = slots[i];
+    // threads which never processed a run (e.g. of the tasking pool)
+    if (!slot.registered) { continue; }
+    stats.push_back(
+      {slot.thread_id,
+       (slot.allocated.load() - slot.allocated_at_reset) / kMB,
+       static_cast<long>(slot.allocations.load() - slot.allocations_at_reset),
+       slot.live.load() / kMB, slot.peak.load() / kMB});
+  }
+  return stats;
+}
+
+//------------------------------------------------------------------------------
+double MemoryTracker::GetLiveMemory() const
+{
+  std::int64_t live = 0;
+  const int n = std::min(nslots.load(), kMaxSlots);
+  for (int i = 0; i < n; i++) {
+    live += slots[i].live.load(std::memory_order_relaxed);
+  }
+  return live / kMB;
+}
+
+//------------------------------------------------------------------------------
+long MemoryTracker::GetLiveSpecies() const
+{
+  long n = 0;
+  const int nslot = std::min(nslots.load(), kMaxSlots);
+  for (int i = 0; i < nslot; i++) {
+    n += slots[i].live_species.load(std::memory_order_relaxed);
+  }
+  return n;
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::SetLiveSpecies(long n)
+{
+  GetSlot().live_species.store(n, std::memory_order_relaxed);
+  if (n > peak_species) { peak_species = n; }
+}
+
+//------------------------------------------------------------------------------
+long MemoryTracker::TakeEventPeakSpecies()
+{
+  long peak = peak_species;
+  peak_species = 0;
+  GetSlot().live_species.store(0, std::memory_order_relaxed);
+  return peak;
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::SetSoftCap(double mb)
+{
+  // NOTE(SO): the resident memory is not a usable measure, the allocator
+  // rarely returns the freed pages so that it seldom drops below the cap
+  if (mb > 0. && !IsAvailable()) {
+    G4Exception("MI::MemoryTracker::SetSoftCap", "MI_MEMORY_001", JustWarning,
+                "The soft cap needs the heap counters "
+                "(cmake -DCHEM6_MEMORY_TRACKER=ON), it is disabled.");
+    mb = 0.;
+  }
+  soft_cap_.store(mb, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::BeginEvent()
+{
+  const double cap = GetSoftCap();
+  if (cap <= 0.) {
+    busy_++;
+    return;
+  }
+
+  auto live = [this]() { return GetLiveMemory(); };
+  std::unique_lock<std::mutex> lock(gate_mutex_);
+  if (waiting_ == 0 && live() <= cap) {
+    busy_++;
+    return;
+  }
+
+  // NOTE(SO): the waiting threads are admitted one per ended event (or when
+  // no event is in flight), so that they do not all start together when the
+  // memory drops below the cap: the events in flight cannot grow while the
+  // cap is exceeded
+  const auto start = std::chrono::steady_clock::now();
+  waiting_++;
+  while (busy_.load() > 0 && (releases_ == 0 || live() > cap)) {
+    gate_.wait_for(lock, std::chrono::milliseconds(10));
+  }
+  if (releases_ > 0) { releases_--; }
+  if (--waiting_ == 0) { releases_ = 0; }
+  busy_++;
+
+  nwaits_++;
+  const double elapsed = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - start).count();
+  wait_time_.store(wait_time_.load() + elapsed);
+}
+
+//------------------------------------------------------------------------------
+void MemoryTracker::EndEvent()
+{
+  if (GetSoftCap() <= 0.) {
+    busy_--;
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(gate_mutex_);
+    busy_--;
+    if (waiting_ > 0) { releases_++; }
+  }
+  gate_.notify_one();
+}
+
+} // end of namespace MI
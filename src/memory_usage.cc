@@ -25,41 +25,34 @@
   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
   EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ==============================================================================*/
-/*============================================================================
-Copyright 2017-2022 Koichi Murakami
+#include "memory_usage.hh"
 
-Distributed under the OSI-approved BSD License (the "License");
-see accompanying file LICENSE for details.
-
-This software is distributed WITHOUT ANY WARRANTY; without even the
-implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
-See the License for more information.
-============================================================================*/
-#ifndef STOPWATCH_H_
-#define STOPWATCH_H_
-
-#include <sys/times.h>
-#include <time.h>
+#include <fstream>
+#include <sys/resource.h>
 #include <unistd.h>
 
-class Stopwatch {
-public:
-  Stopwatch();
-  virtual ~Stopwatch() = default;
-
-  void Reset();
-  void Split();
-
-  double GetRealElapsed() const;
-  double GetSystemElapsed() const;
-  double GetUserElapsed() const;
-
-  const char* GetClockTime() const;
-
-private:
-  clock_t start_clock_, end_clock_;
-  tms start_time_, end_time_;
-
-};
-
+namespace MI {
+
+//------------------------------------------------------------------------------
+double GetResidentMemory()
+{
+  // NOTE(SO): /proc/self/statm gives the sizes in pages (Linux only)
+  std::ifstream statm("/proc/self/statm");
+  long size = 0, resident = 0;
+  if (!(statm >> size >> resident)) { return 0.; }
+  return resident * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024. * 1024.);
+}
+
+//------------------------------------------------------------------------------
+double GetPeakResidentMemory()
+{
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0.; }
+#ifdef __APPLE__
+  return usage.ru_maxrss / (1024. * 1024.);  // bytes
+#else
+  return usage.ru_maxrss / 1024.;  // kilobytes
 #endif
+}
+
+} // end of namespace MI
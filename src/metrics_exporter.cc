@@ -0,0 +1,312 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "metrics_exporter.hh"
+#include "memory_tracker.hh"
+#include "G4Threading.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+
+namespace {
+
+//------------------------------------------------------------------------------
+// label value of the Prometheus text format
+std::string Escape(const std::string& value)
+{
+  std::string escaped;
+  for (char c : value) {
+    if (c == '\\' || c == '"') { escaped += '\\'; }
+    if (c == '\n') { escaped += "\\n"; continue; }
+    escaped += c;
+  }
+  return escaped;
+}
+
+//------------------------------------------------------------------------------
+void WriteHeader(std::ostream& os, const char* name, const char* type,
+                 const char* help)
+{
+  os << "# HELP " << name << ' ' << help << '\n'
+     << "# TYPE " << name << ' ' << type << '\n';
+}
+
+} // end of namespace
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+MetricsExporter* MetricsExporter::Instance()
+{
+  static MetricsExporter instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+MetricsExporter::MetricsExporter()
+  : origin_{std::chrono::steady_clock::now()}
+{}
+
+//------------------------------------------------------------------------------
+MetricsExporter::~MetricsExporter()
+{
+  Stop();
+}
+
+//------------------------------------------------------------------------------
+double MetricsExporter::Now() const
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - origin_).count();
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::Enable(const G4String& file)
+{
+  if (file.empty()) {
+    Stop();
+    enabled_.store(false, std::memory_order_relaxed);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_ = file;
+  enabled_.store(true, std::memory_order_relaxed);
+  if (!writer_.joinable()) {
+    stop_ = false;
+    writer_ = std::thread([this]() { Loop(); });
+  }
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::SetInterval(double seconds)
+{
+  interval_.store(seconds);
+  wakeup_.notify_all();
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::SetSweepPoint(const G4String& label, int index, int npoints)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  sweep_label_ = label;
+  // the points set from a macro are counted
+  sweep_index_ = index >= 0 ? index : sweep_index_ + 1;
+  if (npoints > 0) { sweep_npoints_ = npoints; }
+}
+
+//------------------------------------------------------------------------------
+MetricsExporter::Slot* MetricsExporter::GetSlot()
+{
+  static thread_local Slot* slot = nullptr;
+  if (slot == nullptr) {
+    auto* new_slot = new Slot();
+    new_slot->thread = G4Threading::G4GetThreadId();
+    std::lock_guard<std::mutex> lock(mutex_);
+    slots_.emplace_back(new_slot);
+    slot = new_slot;
+  }
+  return slot;
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::BeginRun(int run_id, long nevents)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // NOTE(SO): the workers are idle between the runs, so that their
+    // counters can be reset here
+    for (auto& slot : slots_) {
+      slot->events.store(0);
+      slot->busy.store(0.);
+    }
+    run_id_.store(run_id);
+    nevents_.store(nevents);
+    aborted_.store(0);
+    run_start_.store(Now());
+    in_run_.store(true);
+    last_events_ = 0;
+    last_time_ = run_start_.load();
+  }
+  if (IsEnabled()) { Write(); }
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::EndRun()
+{
+  run_end_.store(Now());
+  in_run_.store(false);
+  if (IsEnabled()) { Write(); }
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::BeginEvent()
+{
+  if (!IsEnabled()) { return; }
+  GetSlot()->event_start.store(Now());
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::EndEvent(bool aborted)
+{
+  if (!IsEnabled()) { return; }
+  // the counters of a slot are written by its thread only
+  auto* slot = GetSlot();
+  const double start = slot->event_start.load();
+  if (start >= 0.) {
+    slot->busy.store(slot->busy.load() + Now() - start);
+    slot->event_start.store(-1.);
+  }
+  slot->events.store(slot->events.load() + 1);
+  events_total_++;
+  if (aborted) { aborted_++; }
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::Stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!writer_.joinable()) { return; }
+    stop_ = true;
+  }
+  wakeup_.notify_all();
+  writer_.join();
+  Write();
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::Loop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    const auto interval = std::chrono::duration<double>(interval_.load());
+    if (wakeup_.wait_for(lock, interval, [this]() { return stop_; })) { break; }
+    lock.unlock();
+    Write();
+    lock.lock();
+  }
+}
+
+//------------------------------------------------------------------------------
+void MetricsExporter::Write()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const double now = Now();
+  const bool in_run = in_run_.load();
+  const int run_id = run_id_.load();
+  const long nevents = nevents_.load();
+  const double elapsed =
+    run_id < 0 ? 0. : (in_run ? now : run_end_.load()) - run_start_.load();
+
+  long events = 0;
+  for (const auto& slot : slots_) { events += slot->events.load(); }
+
+  const double run_rate = elapsed > 0. ? events / elapsed * 60. : 0.;
+  double rate = run_rate;
+  if (in_run && now > last_time_) {
+    rate = (events - last_events_) / (now - last_time_) * 60.;
+  }
+  last_events_ = events;
+  last_time_ = now;
+
+  double eta = 0.;
+  if (in_run) {
+    eta = run_rate > 0. ? (nevents - events) / run_rate * 60.
+                        : std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const std::string tmp = file_ + ".tmp";
+  std::ofstream os(tmp);
+
+  WriteHeader(os, "chem6_run_id", "gauge", "ID of the current or last run");
+  os << "chem6_run_id " << run_id << '\n';
+  WriteHeader(os, "chem6_run_active", "gauge", "1 while a run is processed");
+  os << "chem6_run_active " << (in_run ? 1 : 0) << '\n';
+  WriteHeader(os, "chem6_run_elapsed_seconds", "gauge",
+              "Wall-clock time of the run");
+  os << "chem6_run_elapsed_seconds " << elapsed << '\n';
+  WriteHeader(os, "chem6_events_requested", "gauge", "Events of the run");
+  os << "chem6_events_requested " << nevents << '\n';
+  WriteHeader(os, "chem6_events_processed", "gauge",
+              "Events processed in the run");
+  os << "chem6_events_processed " << events << '\n';
+  WriteHeader(os, "chem6_events_processed_total", "counter",
+              "Events processed over the runs");
+  os << "chem6_events_processed_total " << events_total_.load() << '\n';
+  WriteHeader(os, "chem6_events_aborted", "gauge",
+              "Events of the run aborted by PrimaryKiller");
+  os << "chem6_events_aborted " << aborted_.load() << '\n';
+  WriteHeader(os, "chem6_events_per_minute", "gauge",
+              "Throughput over the last interval and over the run");
+  os << "chem6_events_per_minute{window=\"interval\"} " << rate << '\n'
+     << "chem6_events_per_minute{window=\"run\"} " << run_rate << '\n';
+  WriteHeader(os, "chem6_eta_seconds", "gauge",
+              "Estimated time remaining of the run");
+  os << "chem6_eta_seconds " << (std::isnan(eta) ? "NaN" : std::to_string(eta))
+     << '\n';
+
+  WriteHeader(os, "chem6_thread_busy_fraction", "gauge",
+              "Fraction of the run spent in events, per thread");
+  for (const auto& slot : slots_) {
+    double busy = slot->busy.load();
+    const double start = slot->event_start.load();
+    if (in_run && start >= 0.) { busy += now - start; }
+    os << "chem6_thread_busy_fraction{thread=\""
+       << (slot->thread < 0 ? std::string("master") : std::to_string(slot->thread))
+       << "\"} " << (elapsed > 0. ? busy / elapsed : 0.) << '\n';
+  }
+
+  WriteHeader(os, "chem6_live_species", "gauge",
+              "Chemical species alive in the events in flight");
+  os << "chem6_live_species " << MemoryTracker::Instance()->GetLiveSpecies()
+     << '\n';
+
+  if (sweep_index_ >= 0) {
+    WriteHeader(os, "chem6_sweep_point", "gauge",
+                "Index of the current point of the sweep");
+    os << "chem6_sweep_point{label=\"" << Escape(sweep_label_) << "\"} "
+       << sweep_index_ << '\n';
+    if (sweep_npoints_ > 0) {
+      WriteHeader(os, "chem6_sweep_points", "gauge", "Points of the sweep");
+      os << "chem6_sweep_points " << sweep_npoints_ << '\n';
+    }
+  }
+  os.close();
+
+  if (!os || std::rename(tmp.c_str(), file_.c_str()) != 0) {
+    static std::atomic<bool> warned{false};
+    if (!warned.exchange(true)) {
+      G4ExceptionDescription msg;
+      msg << "The metrics cannot be written to " << file_;
+      G4Exception("MetricsExporter::Write", "MI_METRICS_001", JustWarning, msg);
+    }
+  }
+}
+
+} // end of namespace MI
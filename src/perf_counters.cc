@@ -0,0 +1,143 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "perf_counters.hh"
+#include "globals.hh"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#endif
+
+namespace MI {
+
+namespace {
+
+#ifdef __linux__
+//------------------------------------------------------------------------------
+// one counter group per thread, the first available counter is the leader
+struct CounterGroup {
+  int leader = -1;
+  int fds[PerfCounters::kNCounters] = {-1, -1, -1, -1};
+  int index[PerfCounters::kNCounters] = {-1, -1, -1, -1};  // in the group
+  int size = 0;
+
+  CounterGroup()
+  {
+    const std::uint64_t configs[PerfCounters::kNCounters] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (int i = 0; i < PerfCounters::kNCounters; i++) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = configs[i];
+      attr.disabled = leader < 0 ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED
+                       | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      // this thread, any CPU
+      int fd = static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+      if (fd < 0) { continue; }
+      if (leader < 0) { leader = fd; }
+      fds[i] = fd;
+      index[i] = size++;
+    }
+    if (leader >= 0) {
+      ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+  }
+
+  ~CounterGroup()
+  {
+    for (auto fd : fds) {
+      if (fd >= 0) { close(fd); }
+    }
+  }
+};
+#endif
+
+} // end of namespace
+
+//------------------------------------------------------------------------------
+PerfCounters* PerfCounters::Instance()
+{
+  static PerfCounters instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+bool PerfCounters::Read(Values& values)
+{
+  values.fill(-1.);
+
+#ifdef __linux__
+  static thread_local CounterGroup group;
+  if (group.leader >= 0) {
+    // nr, time enabled, time running, values
+    std::uint64_t buffer[3 + kNCounters];
+    if (read(group.leader, buffer, sizeof(buffer)) > 0 && buffer[2] > 0) {
+      // scaled when the counters are multiplexed
+      const double scale = double(buffer[1]) / double(buffer[2]);
+      for (int i = 0; i < kNCounters; i++) {
+        if (group.index[i] >= 0) {
+          values[i] = buffer[3 + group.index[i]] * scale;
+        }
+      }
+      return true;
+    }
+  }
+#endif
+
+  if (!warned_.exchange(true)) {
+    G4Exception("MI::PerfCounters::Read", "MI_PERF_001", JustWarning,
+                "Hardware counters are not available "
+                "(see /proc/sys/kernel/perf_event_paranoid).");
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+const char* PerfCounters::GetCounterName(Counter counter)
+{
+  static const char* names[kNCounters] = {
+    "cycles", "instructions", "cache-misses", "branch-misses"
+  };
+  return names[counter];
+}
+
+} // end of namespace MI
@@ -0,0 +1,201 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "perf_messenger.hh"
+#include "memory_tracker.hh"
+#include "metrics_exporter.hh"
+#include "perf_counters.hh"
+#include "reaction_counter.hh"
+#include "tracer.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithADouble.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIdirectory.hh"
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+PerfMessenger::PerfMessenger()
+{
+  perf_dir_ = new G4UIdirectory("/perf/");
+  perf_dir_->SetGuidance("Performance instrumentation");
+
+  trace_dir_ = new G4UIdirectory("/perf/trace/");
+  trace_dir_->SetGuidance("Timeline of the threads (trace-event JSON)");
+
+  trace_file_cmd_ = new G4UIcmdWithAString("/perf/trace/file", this);
+  trace_file_cmd_->SetGuidance("Record the runs, events, event stages, merges");
+  trace_file_cmd_->SetGuidance("and outputs of each thread and write them at");
+  trace_file_cmd_->SetGuidance("exit to the file (chrome://tracing, Perfetto).");
+  trace_file_cmd_->SetParameterName("file", true);
+  trace_file_cmd_->SetDefaultValue("trace.json");
+  trace_file_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  trace_file_cmd_->SetToBeBroadcasted(false);
+
+  trace_size_cmd_ = new G4UIcmdWithAnInteger("/perf/trace/bufferSize", this);
+  trace_size_cmd_->SetGuidance("Number of records kept per thread, the oldest");
+  trace_size_cmd_->SetGuidance("are overwritten (default 65536, 24 bytes each).");
+  trace_size_cmd_->SetGuidance("Set it before the first run: the buffer of a");
+  trace_size_cmd_->SetGuidance("thread is not resized after its first record.");
+  trace_size_cmd_->SetParameterName("size", false);
+  trace_size_cmd_->SetRange("size > 0");
+  trace_size_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  trace_size_cmd_->SetToBeBroadcasted(false);
+
+  counters_dir_ = new G4UIdirectory("/perf/counters/");
+  counters_dir_->SetGuidance("Hardware counters per stage (Linux perf_event)");
+
+  counters_enable_cmd_ = new G4UIcmdWithABool("/perf/counters/enable", this);
+  counters_enable_cmd_->SetGuidance("Count cycles, instructions, cache misses");
+  counters_enable_cmd_->SetGuidance("and branch misses of each stage and print");
+  counters_enable_cmd_->SetGuidance("them with the IPC at the end of the run.");
+  counters_enable_cmd_->SetParameterName("enable", true);
+  counters_enable_cmd_->SetDefaultValue(true);
+  counters_enable_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  counters_enable_cmd_->SetToBeBroadcasted(false);
+
+  memory_dir_ = new G4UIdirectory("/perf/memory/");
+  memory_dir_->SetGuidance("Memory footprint per thread and per event");
+
+  memory_cap_cmd_ = new G4UIcmdWithADouble("/perf/memory/softCapMB", this);
+  memory_cap_cmd_->SetGuidance("Delay the start of an event while the live heap");
+  memory_cap_cmd_->SetGuidance("of the process exceeds the cap (MB) and another");
+  memory_cap_cmd_->SetGuidance("event is in flight (0 = no cap). Needs the heap");
+  memory_cap_cmd_->SetGuidance("counters (-DCHEM6_MEMORY_TRACKER=ON).");
+  memory_cap_cmd_->SetParameterName("cap", false);
+  memory_cap_cmd_->SetRange("cap >= 0.");
+  memory_cap_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  memory_cap_cmd_->SetToBeBroadcasted(false);
+
+  memory_csv_cmd_ = new G4UIcmdWithABool("/perf/memory/csv", this);
+  memory_csv_cmd_->SetGuidance("Write the memory summary of each run to");
+  memory_csv_cmd_->SetGuidance("Memory<runID>.csv (scope,key,value).");
+  memory_csv_cmd_->SetParameterName("enable", true);
+  memory_csv_cmd_->SetDefaultValue(true);
+  memory_csv_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  memory_csv_cmd_->SetToBeBroadcasted(false);
+
+  reactions_dir_ = new G4UIdirectory("/perf/reactions/");
+  reactions_dir_->SetGuidance("Reactions per channel and time decade");
+
+  reactions_enable_cmd_ = new G4UIcmdWithABool("/perf/reactions/enable", this);
+  reactions_enable_cmd_->SetGuidance("Count the reactions per channel and per");
+  reactions_enable_cmd_->SetGuidance("time decade, write them to Reactions<runID>.txt");
+  reactions_enable_cmd_->SetGuidance("and print the dominant channels at the end");
+  reactions_enable_cmd_->SetGuidance("of each run.");
+  reactions_enable_cmd_->SetParameterName("enable", true);
+  reactions_enable_cmd_->SetDefaultValue(true);
+  reactions_enable_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  reactions_enable_cmd_->SetToBeBroadcasted(false);
+
+  metrics_dir_ = new G4UIdirectory("/perf/metrics/");
+  metrics_dir_->SetGuidance("Live progress in the Prometheus text format");
+
+  metrics_file_cmd_ = new G4UIcmdWithAString("/perf/metrics/file", this);
+  metrics_file_cmd_->SetGuidance("Write the progress of the runs periodically");
+  metrics_file_cmd_->SetGuidance("to the file, replaced atomically, e.g. for the");
+  metrics_file_cmd_->SetGuidance("textfile collector of node_exporter.");
+  metrics_file_cmd_->SetParameterName("file", true);
+  metrics_file_cmd_->SetDefaultValue("chem6.prom");
+  metrics_file_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  metrics_file_cmd_->SetToBeBroadcasted(false);
+
+  metrics_interval_cmd_ = new G4UIcmdWithADouble("/perf/metrics/interval", this);
+  metrics_interval_cmd_->SetGuidance("Interval between two writes (s)");
+  metrics_interval_cmd_->SetParameterName("interval", false);
+  metrics_interval_cmd_->SetRange("interval > 0.");
+  metrics_interval_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  metrics_interval_cmd_->SetToBeBroadcasted(false);
+
+  metrics_sweep_cmd_ = new G4UIcmdWithAString("/perf/metrics/sweepPoint", this);
+  metrics_sweep_cmd_->SetGuidance("Label of the next point of a parameter sweep");
+  metrics_sweep_cmd_->SetGuidance("run by the macro (e.g. \"proton 10 MeV\"); the");
+  metrics_sweep_cmd_->SetGuidance("points are counted from 0.");
+  metrics_sweep_cmd_->SetParameterName("label", false);
+  metrics_sweep_cmd_->AvailableForStates(G4State_PreInit, G4State_Idle);
+  metrics_sweep_cmd_->SetToBeBroadcasted(false);
+}
+
+//------------------------------------------------------------------------------
+PerfMessenger::~PerfMessenger()
+{
+  delete trace_file_cmd_;
+  delete trace_size_cmd_;
+  delete counters_enable_cmd_;
+  delete memory_cap_cmd_;
+  delete memory_csv_cmd_;
+  delete reactions_enable_cmd_;
+  delete metrics_file_cmd_;
+  delete metrics_interval_cmd_;
+  delete metrics_sweep_cmd_;
+  delete trace_dir_;
+  delete counters_dir_;
+  delete memory_dir_;
+  delete reactions_dir_;
+  delete metrics_dir_;
+  delete perf_dir_;
+}
+
+//------------------------------------------------------------------------------
+void PerfMessenger::SetNewValue(G4UIcommand* cmd, G4String val)
+{
+  if (cmd == trace_file_cmd_) {
+    Tracer::Instance()->Enable(val);
+  }
+  if (cmd == trace_size_cmd_) {
+    Tracer::Instance()->SetBufferSize(
+      trace_size_cmd_->GetNewIntValue(val));
+  }
+  if (cmd == counters_enable_cmd_) {
+    PerfCounters::Instance()->Enable(
+      counters_enable_cmd_->GetNewBoolValue(val));
+  }
+  if (cmd == memory_cap_cmd_) {
+    MemoryTracker::Instance()->SetSoftCap(
+      memory_cap_cmd_->GetNewDoubleValue(val));
+  }
+  if (cmd == memory_csv_cmd_) {
+    MemoryTracker::Instance()->EnableCSV(
+      memory_csv_cmd_->GetNewBoolValue(val));
+  }
+  if (cmd == reactions_enable_cmd_) {
+    ReactionCounter::Enable(reactions_enable_cmd_->GetNewBoolValue(val));
+  }
+  if (cmd == metrics_file_cmd_) {
+    MetricsExporter::Instance()->Enable(val);
+  }
+  if (cmd == metrics_interval_cmd_) {
+    MetricsExporter::Instance()->SetInterval(
+      metrics_interval_cmd_->GetNewDoubleValue(val));
+  }
+  if (cmd == metrics_sweep_cmd_) {
+    MetricsExporter::Instance()->SetSweepPoint(val);
+  }
+}
+
+} // end of namespace MI
@@ -0,0 +1,173 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "reaction_counter.hh"
+#include "chemistry_snapshot.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <string>
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+ReactionCounter* ReactionCounter::Instance()
+{
+  static G4ThreadLocal ReactionCounter* instance = nullptr;
+  if (instance == nullptr) { instance = new ReactionCounter(); }
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+namespace {
+std::atomic<bool>& Enabled()
+{
+  static std::atomic<bool> enabled{false};
+  return enabled;
+}
+} // end of namespace
+
+//------------------------------------------------------------------------------
+void ReactionCounter::Enable(bool in)
+{
+  Enabled().store(in, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+bool ReactionCounter::IsEnabled()
+{
+  return Enabled().load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void ReactionCounter::Initialize(G4int run_id)
+{
+  ChemistrySnapshot::Build(run_id);
+  if (!IsEnabled()) {
+    counts_.clear();
+    return;
+  }
+  counts_.assign(GetNumberOfChannels() * kNDecades, 0);
+}
+
+//------------------------------------------------------------------------------
+std::size_t ReactionCounter::GetNumberOfChannels() const
+{
+  auto* snapshot = ChemistrySnapshot::Get();
+  return snapshot != nullptr ? snapshot->GetNumberOfReactions() + 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+G4String ReactionCounter::GetChannelName(std::size_t channel) const
+{
+  auto* snapshot = ChemistrySnapshot::Get();
+  if (snapshot == nullptr || channel >= snapshot->GetNumberOfReactions()) {
+    return "others";
+  }
+  return snapshot->GetReactionName(channel);
+}
+
+//------------------------------------------------------------------------------
+int ReactionCounter::GetDecade(double time)
+{
+  if (time < 1. * ps) { return 0; }
+  int decade = static_cast<int>(std::floor(std::log10(time / ps))) + 1;
+  return std::min(decade, kNDecades - 1);
+}
+
+//------------------------------------------------------------------------------
+void ReactionCounter::Count(Species* reactant1, Species* reactant2, double time)
+{
+  if (counts_.empty()) { return; }
+
+  auto* snapshot = ChemistrySnapshot::Get();
+  int channel = static_cast<int>(snapshot->GetNumberOfReactions());
+  if (reactant2 != nullptr) {
+    int index = snapshot->FindReaction(reactant1, reactant2);
+    if (index >= 0) { channel = index; }
+  }
+  counts_[channel * kNDecades + GetDecade(time)]++;
+}
+
+//------------------------------------------------------------------------------
+void ReactionCounter::Absorb(std::vector<G4long>& counts)
+{
+  if (counts.size() != counts_.size()) { counts.resize(counts_.size(), 0); }
+  for (std::size_t i = 0; i < counts_.size(); i++) {
+    counts[i] += counts_[i];
+    counts_[i] = 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+// channels sorted by total number of reactions, nmax = 0 prints all
+void ReactionCounter::Print(const std::vector<G4long>& counts, std::ostream& os,
+                            std::size_t nmax) const
+{
+  const std::size_t nch = std::min(GetNumberOfChannels(),
+                                   counts.size() / kNDecades);
+  std::vector<G4long> total(nch, 0);
+  for (std::size_t c = 0; c < nch; c++) {
+    total[c] = std::accumulate(counts.begin() + c * kNDecades,
+                               counts.begin() + (c + 1) * kNDecades, G4long(0));
+  }
+  const G4long sum = std::accumulate(total.begin(), total.end(), G4long(0));
+
+  std::vector<std::size_t> order(nch);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&total](std::size_t a, std::size_t b) { return total[a] > total[b]; });
+  if (nmax > 0 && nmax < order.size()) { order.resize(nmax); }
+
+  os << std::setw(40) << std::left << "# reaction" << std::right
+     << std::setw(12) << "total" << std::setw(8) << "(%)";
+  for (int d = 0; d < kNDecades; d++) {
+    std::string label = d == kNDecades - 1
+                          ? ">=1e" + std::to_string(d - 1) + "ps"
+                          : "<1e" + std::to_string(d) + "ps";
+    os << std::setw(12) << label;
+  }
+  os << '\n';
+
+  for (auto c : order) {
+    if (total[c] == 0) { continue; }
+    os << std::setw(40) << std::left << GetChannelName(c) << std::right
+       << std::setw(12) << total[c] << std::setw(8) << std::fixed
+       << std::setprecision(2) << (sum > 0 ? 100. * total[c] / sum : 0.);
+    for (int d = 0; d < kNDecades; d++) {
+      os << std::setw(12) << counts[c * kNDecades + d];
+    }
+    os << '\n';
+  }
+  os.unsetf(std::ios::fixed);
+}
+
+} // end of namespace MI
@@ -0,0 +1,231 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "reaction_log.hh"
+#include "G4H2O.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace {
+
+const char kMagic[8] = {'M', 'I', 'L', 'O', 'G', '0', '0', '1'};
+const std::uint32_t kSpeciesChunk = 1;
+const std::uint32_t kEventChunk = 2;
+const std::uint32_t kRunChunk = 3;
+const std::uint32_t kSolventChunk = 4;
+
+//------------------------------------------------------------------------------
+template <typename T>
+void Append(std::string& buf, T value)
+{
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  buf.append(bytes, sizeof(T));
+}
+
+//------------------------------------------------------------------------------
+void WriteChunk(std::ofstream& file, std::uint32_t type, const std::string& payload)
+{
+  std::string header;
+  Append(header, type);
+  Append(header, static_cast<std::uint32_t>(payload.size()));
+  file.write(header.data(), header.size());
+  file.write(payload.data(), payload.size());
+}
+
+} // end of namespace
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+ReactionLog* ReactionLog::Instance()
+{
+  static G4ThreadLocal ReactionLog* instance = nullptr;
+  if (instance == nullptr) { instance = new ReactionLog(); }
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+ReactionLog::~ReactionLog()
+{
+  if (file_.is_open()) { file_.close(); }
+}
+
+//------------------------------------------------------------------------------
+void ReactionLog::Enable(const G4String& prefix)
+{
+  enabled_ = true;
+  if (prefix.empty()) {
+    file_name_ = "";
+    return;
+  }
+  G4int tid = G4Threading::G4GetThreadId();
+  file_name_ = tid < 0 ? prefix + ".bin"
+                       : prefix + "_t" + std::to_string(tid) + ".bin";
+}
+
+//------------------------------------------------------------------------------
+void ReactionLog::Clear()
+{
+  entries_.clear();
+  sorted_ = true;
+}
+
+//------------------------------------------------------------------------------
+std::uint16_t ReactionLog::GetIndex(Species* species)
+{
+  auto itr = index_.find(species);
+  if (itr != index_.end()) { return itr->second; }
+
+  auto idx = static_cast<std::uint16_t>(species_.size());
+  species_.push_back(species);
+  index_[species] = idx;
+  if (species->GetDefinition() == G4H2O::Definition()) { solvent_.push_back(idx); }
+  return idx;
+}
+
+//------------------------------------------------------------------------------
+void ReactionLog::Record(Species* species, double time, int delta)
+{
+  if (!enabled_ || species == nullptr) { return; }
+  if (!entries_.empty() && time < entries_.back().time) { sorted_ = false; }
+  entries_.push_back({time, GetIndex(species), static_cast<std::int16_t>(delta)});
+}
+
+//------------------------------------------------------------------------------
+void ReactionLog::SortEntries()
+{
+  if (sorted_) { return; }
+  std::stable_sort(entries_.begin(), entries_.end(),
+                   [](const Entry& a, const Entry& b) { return a.time < b.time; });
+  sorted_ = true;
+}
+
+//------------------------------------------------------------------------------
+void ReactionLog::CountAtTimes(
+  const std::set<double>& times,
+  std::map<double, std::map<Species*, double>>& counts)
+{
+  counts.clear();
+  SortEntries();
+
+  // only the species seen in this event are reported
+  std::vector<double> n(species_.size(), 0.);
+  std::vector<bool> seen(species_.size(), false);
+  for (const auto& e : entries_) { seen[e.index] = true; }
+
+  // a destruction without creation is a bug of the bookkeeping, which would
+  // silently bias the yields
+  auto add = [this, &n](const Entry& e) {
+    n[e.index] += e.delta;
+    if (n[e.index] < 0.) {
+      G4ExceptionDescription msg;
+      msg << "Negative number of " << species_[e.index]->GetName() << " at "
+          << e.time / ns << " ns in the reaction log.";
+      G4Exception("MI::ReactionLog::CountAtTimes", "MI_LOG_002", FatalException, msg);
+    }
+  };
+
+  std::size_t i = 0;
+  for (auto time : times) {
+    for (; i < entries_.size() && entries_[i].time <= time; i++) {
+      add(entries_[i]);
+    }
+    auto& count = counts[time];
+    for (std::size_t k = 0; k < n.size(); k++) {
+      if (seen[k]) { count[species_[k]] = n[k]; }
+    }
+  }
+  for (; i < entries_.size(); i++) { add(entries_[i]); }
+}
+
+//------------------------------------------------------------------------------
+void ReactionLog::Write(int run_id, int event_id, double edep)
+{
+  if (!enabled_ || file_name_.empty()) { return; }
+  if (!file_.is_open()) {
+    file_.open(file_name_, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+      G4ExceptionDescription msg;
+      msg << "The reaction log cannot be written to " << file_name_;
+      G4Exception("MI::ReactionLog::Write", "MI_LOG_001", FatalException, msg);
+      return;
+    }
+    file_.write(kMagic, sizeof(kMagic));
+  }
+
+  // the runs of a sweep (several /run/beamOn) are kept apart
+  if (run_id != written_run_) {
+    std::string payload;
+    Append(payload, static_cast<std::int32_t>(run_id));
+    WriteChunk(file_, kRunChunk, payload);
+    written_run_ = run_id;
+  }
+
+  if (nwritten_species_ < species_.size()) {
+    std::string payload;
+    Append(payload, static_cast<std::uint32_t>(species_.size() - nwritten_species_));
+    for (auto k = nwritten_species_; k < species_.size(); k++) {
+      const auto& name = species_[k]->GetName();
+      Append(payload, static_cast<std::uint16_t>(k));
+      Append(payload, static_cast<std::uint16_t>(name.size()));
+      payload.append(name);
+    }
+    WriteChunk(file_, kSpeciesChunk, payload);
+    nwritten_species_ = species_.size();
+  }
+  if (nwritten_solvent_ < solvent_.size()) {
+    std::string payload;
+    Append(payload, static_cast<std::uint32_t>(solvent_.size() - nwritten_solvent_));
+    for (auto k = nwritten_solvent_; k < solvent_.size(); k++) {
+      Append(payload, solvent_[k]);
+    }
+    WriteChunk(file_, kSolventChunk, payload);
+    nwritten_solvent_ = solvent_.size();
+  }
+
+  SortEntries();
+  std::string payload;
+  payload.reserve(16 + entries_.size() * 12);
+  Append(payload, static_cast<std::int32_t>(event_id));
+  Append(payload, edep / eV);
+  Append(payload, static_cast<std::uint32_t>(entries_.size()));
+  for (const auto& e : entries_) {
+    Append(payload, e.time / ns);
+    Append(payload, e.index);
+    Append(payload, e.delta);
+  }
+  WriteChunk(file_, kEventChunk, payload);
+  file_.flush();
+}
+
+} // end of namespace MI
@@ -0,0 +1,136 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "species_filter.hh"
+#include "chemistry_snapshot.hh"
+#include "G4H2O.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4MoleculeCounter.hh"
+#include "G4MoleculeTable.hh"
+#include "G4Version.hh"
+
+#include <map>
+
+#if G4VERSION_NUMBER >= 1140 || \
+   (G4VERSION_NUMBER >= 1132 && G4VERSION_REFERENCE_TAG >= 6)
+#define NEW_MOLECULE_COUNTER
+#endif
+
+#ifdef NEW_MOLECULE_COUNTER
+#include "G4MoleculeCounterManager.hh"
+#endif
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+SpeciesFilter* SpeciesFilter::Instance()
+{
+  static G4ThreadLocal SpeciesFilter* instance = nullptr;
+  if (instance == nullptr) { instance = new SpeciesFilter(); }
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+void SpeciesFilter::AddScoredSpecies(const G4String& name)
+{
+  scored_names_.insert(name);
+}
+
+//------------------------------------------------------------------------------
+void SpeciesFilter::Update(G4int run_id)
+{
+  scored_.clear();
+  dropped_.clear();
+  if (scored_names_.empty()) { return; }
+
+  auto* mtable = G4MoleculeTable::Instance();
+  for (const auto& name : scored_names_) {
+    auto* conf = mtable->GetConfiguration(name, false);
+    if (conf == nullptr) {
+      G4ExceptionDescription msg;
+      msg << "Scored species " << name << " is not defined.";
+      G4Exception("MI::SpeciesFilter::Update", "MI_FILTER_001",
+                  JustWarning, msg);
+      continue;
+    }
+    scored_.insert(conf);
+  }
+
+  // a molecule definition is ignored by the counter only if all of its
+  // configurations are dropped
+  ChemistrySnapshot::Build(run_id);
+  auto* snapshot = ChemistrySnapshot::Get();
+  if (snapshot == nullptr) {
+    G4Exception("MI::SpeciesFilter::Update", "MI_FILTER_002", JustWarning,
+                "The reaction table is empty, no species is dropped.");
+  }
+  std::map<const G4MoleculeDefinition*, bool> all_dropped;
+  auto itr = mtable->GetConfigurationIterator();
+  itr.reset();
+  while (itr()) {
+    Species* conf = itr.value();
+    auto* def = conf->GetDefinition();
+    if (def == G4H2O::Definition()) { continue; }
+
+    // without a snapshot the reactivity is unknown, nothing is dropped
+    bool inert = snapshot != nullptr && !snapshot->IsReactive(conf);
+    bool dropped = inert && scored_.count(conf) == 0;
+    if (dropped) { dropped_.insert(conf); }
+
+    auto res = all_dropped.insert(std::make_pair(def, dropped));
+    if (!res.second) { res.first->second = res.first->second && dropped; }
+  }
+
+  // NOTE(SO): the molecule counter cannot register an ignored molecule
+  // again, a species dropped in a previous run must stay dropped
+  for (const auto& it : all_dropped) {
+    if (it.second || ignored_.count(it.first) == 0) { continue; }
+    G4ExceptionDescription msg;
+    msg << "The molecule " << it.first->GetName() << " was ignored by the "
+        << "molecule counter in a previous run and is scored or can react in "
+        << "run " << run_id << ". The scored species and the reactions of "
+        << "the dropped species cannot change between runs.";
+    G4Exception("MI::SpeciesFilter::Update", "MI_FILTER_003",
+                FatalException, msg);
+    return;
+  }
+
+#ifdef NEW_MOLECULE_COUNTER
+  auto* counter =
+    G4MoleculeCounterManager::Instance()->GetMoleculeCounter<G4MoleculeCounter>(0);
+#endif
+  for (const auto& it : all_dropped) {
+    if (!it.second || !ignored_.insert(it.first).second) { continue; }
+#ifdef NEW_MOLECULE_COUNTER
+    if (counter != nullptr) { counter->IgnoreMolecule(it.first); }
+#else
+    G4MoleculeCounter::Instance()->DontRegister(it.first);
+#endif
+  }
+}
+
+} // end of namespace MI
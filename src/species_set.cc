@@ -0,0 +1,175 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "species_set.hh"
+#include "G4Molecule.hh"
+#include "G4MolecularConfiguration.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Threading.hh"
+#include "G4Track.hh"
+#include "Randomize.hh"
+
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace {
+
+// NOTE(SO): approximate yields (per 100 eV) at 1 ps of the water radiolysis
+// by low-LET radiation, only meant for synthetic benchmarks
+const std::pair<const char*, G4double> kYields[] = {
+  {"e_aq", 4.8}, {"°OH", 5.9}, {"H3Op", 4.8}, {"H", 0.6},
+  {"H2", 0.2}, {"H2O2", 0.1}
+};
+
+const G4double kInitialTime = 1. * picosecond;
+
+} // end of namespace
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+std::vector<SpeciesSet> ReadSpeciesSets(const G4String& file_name)
+{
+  std::vector<SpeciesSet> sets;
+  std::ifstream file(file_name);
+  if (!file) {
+    G4Exception("MI::ReadSpeciesSets", "MI_SPECIES_SET_001", FatalException,
+                ("Cannot open the species sets " + file_name).c_str());
+    return sets;
+  }
+
+  // the events are kept in the order of the file
+  G4int current = 0;
+  bool first = true;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') { continue; }
+    std::istringstream is(line);
+    G4int event_id;
+    std::string species;
+    G4double x, y, z, t;
+    if (!(is >> event_id >> species >> x >> y >> z >> t)) { continue; }
+    if (first || event_id != current) {
+      sets.emplace_back();
+      current = event_id;
+      first = false;
+    }
+    sets.back().push_back(
+      {species, G4ThreeVector(x, y, z) * nm, t * picosecond});
+  }
+  return sets;
+}
+
+//------------------------------------------------------------------------------
+SpeciesSet MakeUniformSpeciesSet(G4int n, G4double size)
+{
+  G4double sum = 0.;
+  for (const auto& yield : kYields) { sum += yield.second; }
+
+  SpeciesSet set;
+  set.reserve(n);
+  for (const auto& yield : kYields) {
+    auto nspecies = G4int(n * yield.second / sum + 0.5);
+    for (G4int i = 0; i < nspecies; i++) {
+      G4ThreeVector position((G4UniformRand() - 0.5) * size,
+                             (G4UniformRand() - 0.5) * size,
+                             (G4UniformRand() - 0.5) * size);
+      set.push_back({yield.first, position, kInitialTime});
+    }
+  }
+  return set;
+}
+
+//------------------------------------------------------------------------------
+SpeciesSet MakeTrackSpeciesSet(G4double let, G4double length, G4double radius)
+{
+  // numbers of species per 100 eV deposited along the track
+  const G4double edep = let * length;
+
+  SpeciesSet set;
+  for (const auto& yield : kYields) {
+    auto nspecies = G4int(yield.second * edep / (100. * eV) + 0.5);
+    for (G4int i = 0; i < nspecies; i++) {
+      G4ThreeVector position(G4RandGauss::shoot(0., radius),
+                             G4RandGauss::shoot(0., radius),
+                             (G4UniformRand() - 0.5) * length);
+      set.push_back({yield.first, position, kInitialTime});
+    }
+  }
+  return set;
+}
+
+//------------------------------------------------------------------------------
+SpeciesSetWriter* SpeciesSetWriter::Instance()
+{
+  static G4ThreadLocal SpeciesSetWriter* instance = nullptr;
+  if (instance == nullptr) { instance = new SpeciesSetWriter(); }
+  return instance;
+}
+
+//------------------------------------------------------------------------------
+SpeciesSetWriter::~SpeciesSetWriter()
+{
+  if (file_.is_open()) { file_.close(); }
+}
+
+//------------------------------------------------------------------------------
+void SpeciesSetWriter::Enable(const G4String& prefix)
+{
+  enabled_ = true;
+  G4int tid = G4Threading::G4GetThreadId();
+  file_name_ = tid < 0 ? prefix + ".txt"
+                       : prefix + "_t" + std::to_string(tid) + ".txt";
+}
+
+//------------------------------------------------------------------------------
+void SpeciesSetWriter::Add(const G4Track* track)
+{
+  if (!enabled_) { return; }
+  auto* species = GetMolecule(track)->GetMolecularConfiguration();
+  entries_.push_back(
+    {species->GetUserID(), track->GetPosition(), track->GetGlobalTime()});
+}
+
+//------------------------------------------------------------------------------
+void SpeciesSetWriter::Write(G4int event_id)
+{
+  if (!enabled_) { return; }
+  if (!file_.is_open()) {
+    file_.open(file_name_);
+    file_ << "# event species x[nm] y[nm] z[nm] t[ps]\n";
+  }
+  for (const auto& e : entries_) {
+    file_ << event_id << ' ' << e.species << ' ' << e.position.x() / nm << ' '
+          << e.position.y() / nm << ' ' << e.position.z() / nm << ' '
+          << e.time / picosecond << '\n';
+  }
+  entries_.clear();
+}
+
+} // end of namespace MI
@@ -0,0 +1,161 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "startup_profiler.hh"
+#include "memory_usage.hh"
+#include "G4StateManager.hh"
+#include "G4Threading.hh"
+#include "G4VStateDependent.hh"
+
+#include <fstream>
+#include <iomanip>
+
+namespace MI {
+
+namespace {
+
+//------------------------------------------------------------------------------
+// opens the "physics tables" phase at the first run initialisation of the
+// thread; owned (and deleted) by the state manager of the thread
+class PhysicsTablesWatcher : public G4VStateDependent {
+public:
+  G4bool Notify(G4ApplicationState requested) override
+  {
+    // NOTE(SO): the current state is still the one being left
+    const auto current = G4StateManager::GetStateManager()->GetCurrentState();
+    if (!begun_ && current == G4State_Idle && requested == G4State_Init) {
+      begun_ = true;
+      StartupProfiler::Instance()->Begin("physics tables");
+    }
+    else if (begun_ && !ended_ && current == G4State_Init
+             && requested == G4State_Idle) {
+      ended_ = true;
+      StartupProfiler::Instance()->End("physics tables");
+    }
+    return true;
+  }
+
+private:
+  G4bool begun_{false};
+  G4bool ended_{false};
+};
+
+} // end of anonymous namespace
+
+//------------------------------------------------------------------------------
+StartupProfiler* StartupProfiler::Instance()
+{
+  static StartupProfiler instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+StartupProfiler::StartupProfiler()
+  : t0_{std::chrono::steady_clock::now()}
+{}
+
+//------------------------------------------------------------------------------
+double StartupProfiler::GetTime() const
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - t0_).count();
+}
+
+//------------------------------------------------------------------------------
+void StartupProfiler::Begin(const G4String& phase)
+{
+  const double now = GetTime();
+  std::lock_guard<std::mutex> lock(mutex_);
+  phases_.push_back({phase, G4Threading::G4GetThreadId(), now, -1., 0.});
+}
+
+//------------------------------------------------------------------------------
+void StartupProfiler::End(const G4String& phase)
+{
+  const double now = GetTime();
+  const double peak = GetPeakResidentMemory();
+  const G4int thread = G4Threading::G4GetThreadId();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto itr = phases_.rbegin(); itr != phases_.rend(); ++itr) {
+    if (itr->name == phase && itr->thread == thread && itr->end < 0.) {
+      itr->end = now;
+      itr->peak_rss = peak;
+      return;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void StartupProfiler::WatchPhysicsTables()
+{
+  static G4ThreadLocal G4bool watched = false;
+  if (watched) { return; }
+  watched = true;
+  // registered to the state manager of the calling thread
+  new PhysicsTablesWatcher();
+}
+
+//------------------------------------------------------------------------------
+void StartupProfiler::Reset()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  t0_ = std::chrono::steady_clock::now();
+  phases_.clear();
+  reported_ = false;
+}
+
+//------------------------------------------------------------------------------
+void StartupProfiler::Report(std::ostream& os, const G4String& file)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (reported_) { return; }
+  reported_ = true;
+
+  std::ofstream csv(file);
+  csv << "phase,thread,start_s,duration_s,peak_rss_mb\n";
+
+  const auto precision = os.precision();
+  os << "Startup breakdown:" << std::endl;
+  os << std::setw(36) << std::left << "phase" << std::right
+     << std::setw(8) << "thread" << std::setw(12) << "start (s)"
+     << std::setw(14) << "duration (s)" << std::setw(16) << "peak RSS (MB)"
+     << std::endl;
+  for (const auto& phase : phases_) {
+    if (phase.end < 0.) { continue; }
+    const double duration = phase.end - phase.start;
+    os << std::setw(36) << std::left << phase.name << std::right
+       << std::setw(8) << phase.thread << std::fixed << std::setprecision(3)
+       << std::setw(12) << phase.start << std::setw(14) << duration
+       << std::setprecision(1) << std::setw(16) << phase.peak_rss << std::endl;
+    os.unsetf(std::ios::fixed);
+    csv << phase.name << "," << phase.thread << "," << phase.start << ","
+        << duration << "," << phase.peak_rss << "\n";
+  }
+  os.precision(precision);
+}
+
+} // end of namespace MI
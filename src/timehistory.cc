@@ -37,15 +37,10 @@ See the License for more information.
 ============================================================================*/
 #include <iostream>
 #include <iomanip>
-#include <mutex>
+#include <ctime>
+#include <time.h>
 #include "timehistory.hh"
-
-// --------------------------------------------------------------------------
-namespace {
-
-std::mutex mtx;
-
-} // end of namespace
+#include "tracer.hh"
 
 // --------------------------------------------------------------------------
 TimeHistory* TimeHistory::GetTimeHistory()
@@ -56,80 +51,114 @@ TimeHistory* TimeHistory::GetTimeHistory()
 
 // --------------------------------------------------------------------------
 TimeHistory::TimeHistory()
-  : sw_(), t0_(0.)
+  : t0_(std::chrono::steady_clock::now())
+{
+}
+
+// --------------------------------------------------------------------------
+double TimeHistory::Now() const
+{
+  return std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - t0_).count();
+}
+
+// --------------------------------------------------------------------------
+double TimeHistory::ThreadCPUTime()
+{
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1.e-9;
+}
+
+// --------------------------------------------------------------------------
+void TimeHistory::ReadCounters(MI::PerfCounters::Values& values)
 {
-  split_history_.clear();
+  auto* counters = MI::PerfCounters::Instance();
+  if ( counters-> IsEnabled() ) counters-> Read(values);
+  else values.fill(-1.);
+}
 
-  sw_.Split();
-  t0_ = sw_.GetRealElapsed();
+// --------------------------------------------------------------------------
+TimeHistory::ThreadBuffer* TimeHistory::GetThreadBuffer() const
+{
+  // the lock is only taken at the first use by each thread
+  static thread_local ThreadBuffer* buffer = nullptr;
+  if ( buffer == nullptr ) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    buffers_.emplace_back(new ThreadBuffer());
+    buffer = buffers_.back().get();
+  }
+  return buffer;
 }
 
 // --------------------------------------------------------------------------
 void TimeHistory::TakeSplit(const std::string& key)
 {
-  sw_.Split();
-  double split = sw_.GetRealElapsed();
-  ::mtx.lock();
-  split_history_[key] = split - t0_;
-  ::mtx.unlock();
+  double split = Now();
+  auto* buffer = GetThreadBuffer();
+  std::lock_guard<std::mutex> lock(buffer-> split_mutex);
+  buffer-> split_history[key] = split;
 }
 
 // --------------------------------------------------------------------------
 double TimeHistory::TakeSplit()
 {
-  sw_.Split();
-  double split = sw_.GetRealElapsed();
-  double t1 = split - t0_;
-  return t1;
+  return Now();
 }
 
 // --------------------------------------------------------------------------
 bool TimeHistory::FindAKey(const std::string& key) const
 {
-  std::map<std::string, double>::const_iterator itr;
-  itr = split_history_.find(key);
-  if ( itr != split_history_.end() ) return true;
-  else return false;
+  if ( GetThreadBuffer()-> split_history.count(key) > 0 ) return true;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for ( const auto& buffer : buffers_ ) {
+    std::lock_guard<std::mutex> split_lock(buffer-> split_mutex);
+    if ( buffer-> split_history.count(key) > 0 ) return true;
+  }
+  return false;
 }
 
 // --------------------------------------------------------------------------
 double TimeHistory::GetTime(const std::string& key) const
 {
-  std::map<std::string, double>::const_iterator itr;
-  itr = split_history_.find(key);
-  if ( itr != split_history_.end() ) {
-    return itr-> second;
-  } else {
-    std::cout << "[WARNING] TimeHistory::GetTime() cannot find a key. "
-              << key << std::endl;
-    return 0.;
+  // the calling thread first, then the others
+  const auto* own = GetThreadBuffer();
+  auto itr = own-> split_history.find(key);
+  if ( itr != own-> split_history.end() ) return itr-> second;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for ( const auto& buffer : buffers_ ) {
+    std::lock_guard<std::mutex> split_lock(buffer-> split_mutex);
+    itr = buffer-> split_history.find(key);
+    if ( itr != buffer-> split_history.end() ) return itr-> second;
   }
+  std::cout << "[WARNING] TimeHistory::GetTime() cannot find a key. "
+            << key << std::endl;
+  return 0.;
 }
 
 // --------------------------------------------------------------------------
 void TimeHistory::ShowHistory(const std::string& key) const
 {
-  ::mtx.lock();
-  std::map<std::string, double>::const_iterator itr;
-  itr = split_history_.find(key);
-  if ( itr != split_history_.end() ) {
-    std::cout << "[" << itr-> first << "] : "
-              << itr-> second << "s" << std::endl;
+  if ( FindAKey(key) ) {
+    std::cout << "[" << key << "] : " << GetTime(key) << "s" << std::endl;
   } else {
     std::cout << "[WARNING] TimeHistory::ShowHistory() cannot find a key. "
               << key << std::endl;
   }
-  ::mtx.unlock();
 }
 
 // --------------------------------------------------------------------------
 void TimeHistory::ShowAllHistories() const
 {
-  ::mtx.lock();
+  std::lock_guard<std::mutex> lock(mutex_);
   std::multimap<double, std::string> histories_by_time;
-  std::map<std::string, double>::const_iterator itr;
-  for ( itr = split_history_.begin(); itr != split_history_.end(); ++itr) {
-    histories_by_time.insert(std::make_pair(itr->second, itr->first));
+  for ( const auto& buffer : buffers_ ) {
+    std::lock_guard<std::mutex> split_lock(buffer-> split_mutex);
+    for ( const auto& it : buffer-> split_history ) {
+      histories_by_time.insert(std::make_pair(it.second, it.first));
+    }
   }
 
   std::cout << "* All time histories" << std::endl;
@@ -141,13 +170,108 @@ void TimeHistory::ShowAllHistories() const
               << std::fixed << std::setprecision(3)
               << itr2-> first << " s" << std::endl;
   }
-  ::mtx.unlock();
 }
 
 // --------------------------------------------------------------------------
 void TimeHistory::ShowClock(const std::string& prefix) const
 {
-  ::mtx.lock();
-  std::cout << prefix << " " << sw_.GetClockTime() << std::flush;
-  ::mtx.unlock();
+  time_t timer;
+  time(&timer);
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::cout << prefix << " " << ctime(&timer) << std::flush;
+}
+
+// --------------------------------------------------------------------------
+void TimeHistory::BeginStage(Stage stage)
+{
+  OpenStage open{stage, Now(), ThreadCPUTime(), 0., {}};
+  ReadCounters(open.counters);
+  GetThreadBuffer()-> stack.push_back(open);
+}
+
+// --------------------------------------------------------------------------
+void TimeHistory::EndStage(Stage stage)
+{
+  const double now = Now();
+  const double cpu = ThreadCPUTime();
+  auto* buffer = GetThreadBuffer();
+  auto& stack = buffer-> stack;
+
+  bool open = false;
+  for ( const auto& it : stack ) open = open || it.stage == stage;
+  if ( !open ) return;
+
+  MI::PerfCounters::Values counters;
+  ReadCounters(counters);
+
+  // stages left open inside this one are closed with it
+  while ( !stack.empty() ) {
+    OpenStage open = stack.back();
+    stack.pop_back();
+    const double elapsed = now - open.start;
+    auto& record = buffer-> stages[open.stage];
+    record.total += elapsed;
+    record.self += elapsed - open.children;
+    record.count++;
+    for ( int i = 0; i < MI::PerfCounters::kNCounters; i++ ) {
+      if ( counters[i] < 0. || open.counters[i] < 0. ) continue;
+      if ( record.counters[i] < 0. ) record.counters[i] = 0.;
+      record.counters[i] += counters[i] - open.counters[i];
+    }
+    buffer-> event_wall[open.stage] += elapsed;
+    buffer-> event_cpu[open.stage] += cpu - open.cpu_start;
+    if ( !stack.empty() ) stack.back().children += elapsed;
+    MI::Tracer::Instance()-> Record(GetStageName(open.stage), open.start, now);
+    if ( open.stage == stage ) break;
+  }
+}
+
+// --------------------------------------------------------------------------
+std::vector<TimeHistory::StageRecord> TimeHistory::GetStageRecords() const
+{
+  std::vector<StageRecord> records(kNStages);
+  std::lock_guard<std::mutex> lock(mutex_);
+  for ( const auto& buffer : buffers_ ) {
+    for ( int i = 0; i < kNStages; i++ ) {
+      records[i].total += buffer-> stages[i].total;
+      records[i].self += buffer-> stages[i].self;
+      records[i].count += buffer-> stages[i].count;
+      for ( int j = 0; j < MI::PerfCounters::kNCounters; j++ ) {
+        const double value = buffer-> stages[i].counters[j];
+        if ( value < 0. ) continue;
+        if ( records[i].counters[j] < 0. ) records[i].counters[j] = 0.;
+        records[i].counters[j] += value;
+      }
+    }
+  }
+  return records;
+}
+
+// --------------------------------------------------------------------------
+void TimeHistory::ResetStages()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for ( auto& buffer : buffers_ ) {
+    for ( auto& record : buffer-> stages ) record = StageRecord();
+  }
+}
+
+// --------------------------------------------------------------------------
+void TimeHistory::TakeEventStages(StageTimes& wall, StageTimes& cpu)
+{
+  auto* buffer = GetThreadBuffer();
+  wall = buffer-> event_wall;
+  cpu = buffer-> event_cpu;
+  buffer-> event_wall.fill(0.);
+  buffer-> event_cpu.fill(0.);
+}
+
+// --------------------------------------------------------------------------
+const char* TimeHistory::GetStageName(Stage stage)
+{
+  static const char* names[kNStages] = {
+    "run", "event", "physics", "pre-chemistry", "chemistry", "scoring",
+    "merge", "absorb"
+  };
+  return names[stage];
 }
@@ -0,0 +1,125 @@
+/*==============================================================================
+  BSD 2-Clause License
+
+  Copyright (c) 2025 Shogo OKADA (shogo.okada@kek.jp)
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+
+  1. Redistributions of source code must retain the above copyright notice,
+     this list of conditions and the following disclaimer.
+  2. Redistributions in binary form must reproduce the above copyright notice,
+     this list of conditions and the following disclaimer in the documentation
+     and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY,
+  OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+==============================================================================*/
+#include "tracer.hh"
+#include "timehistory.hh"
+#include "G4Threading.hh"
+
+#include <fstream>
+#include <iomanip>
+
+namespace MI {
+
+//------------------------------------------------------------------------------
+Tracer* Tracer::Instance()
+{
+  static Tracer instance;
+  return &instance;
+}
+
+//------------------------------------------------------------------------------
+void Tracer::Enable(const G4String& file)
+{
+  file_ = file;
+  enabled_.store(!file.empty(), std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+Tracer::Ring* Tracer::GetRing()
+{
+  static thread_local Ring* ring = nullptr;
+  if (ring == nullptr) {
+    auto* new_ring = new Ring();
+    new_ring->thread = G4Threading::G4GetThreadId();
+    new_ring->entries.resize(buffer_size_ > 0 ? buffer_size_ : 1);
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings_.emplace_back(new_ring);
+    ring = new_ring;
+  }
+  return ring;
+}
+
+//------------------------------------------------------------------------------
+void Tracer::Record(const char* name, double start, double end)
+{
+  if (!IsEnabled()) { return; }
+  auto* ring = GetRing();
+  ring->entries[ring->next] = {name, start, end};
+  ring->next = (ring->next + 1) % ring->entries.size();
+  if (ring->count < ring->entries.size()) { ring->count++; }
+}
+
+//------------------------------------------------------------------------------
+Tracer::Scope::Scope(const char* name)
+  : name_{name},
+    start_{Tracer::Instance()->IsEnabled()
+             ? TimeHistory::GetTimeHistory()->TakeSplit() : 0.}
+{}
+
+//------------------------------------------------------------------------------
+Tracer::Scope::~Scope()
+{
+  auto* tracer = Tracer::Instance();
+  if (!tracer->IsEnabled()) { return; }
+  tracer->Record(name_, start_, TimeHistory::GetTimeHistory()->TakeSplit());
+}
+
+//------------------------------------------------------------------------------
+void Tracer::Write()
+{
+  if (!IsEnabled()) { return; }
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  std::ofstream os(file_);
+  os << std::fixed << std::setprecision(3);
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  bool first = true;
+  for (const auto& ring : rings_) {
+    // the master is -1
+    const G4int tid = ring->thread + 1;
+    os << (first ? "" : ",\n")
+       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << tid
+       << ",\"args\":{\"name\":\""
+       << (ring->thread < 0 ? G4String("master")
+                            : "worker " + std::to_string(ring->thread))
+       << "\"}}";
+    first = false;
+
+    const std::size_t size = ring->entries.size();
+    const std::size_t oldest = (ring->next + size - ring->count) % size;
+    for (std::size_t i = 0; i < ring->count; i++) {
+      const auto& entry = ring->entries[(oldest + i) % size];
+      os << ",\n{\"name\":\"" << entry.name << "\",\"ph\":\"X\",\"pid\":0,"
+         << "\"tid\":" << tid << ",\"ts\":" << entry.start * 1.e6
+         << ",\"dur\":" << (entry.end - entry.start) * 1.e6 << "}";
+    }
+  }
+  os << "\n]}\n";
+  G4cout << "Trace written to " << file_ << G4endl;
+}
+
+} // end of namespace MI